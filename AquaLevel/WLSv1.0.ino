@@ -8,8 +8,13 @@
  * - config.h: Global constants and configuration
  * - eeprom_manager: Handles saving/loading settings
  * - sensor_manager: Handles ultrasonic sensor readings
+ * - temperature_manager: Air temperature for speed of sound compensation
+ * - adaptive_sampler: Varies the sampling period with the rate of change
+ * - power_manager: Deep sleep duty cycling with state kept in RTC memory
  * - tank_calculator: Calculates water level and volume
  * - web_interface: Web server and UI
+ * - live_socket: WebSocket live data frames and commands
+ * - history_manager: On-device level history with downsampled tiers
  * - wifi_manager: WiFi access point setup and mDNS support
  * 
  * Features:
@@ -25,7 +30,12 @@
 #include "sensor_manager.h"
 #include "tank_calculator.h"
 #include "web_interface.h"
+#include "live_socket.h"
 #include "wifi_manager.h"
+#include "temperature_manager.h"
+#include "adaptive_sampler.h"
+#include "power_manager.h"
+#include "history_manager.h"
 
 
 // For managing reading timing
@@ -54,10 +64,20 @@ void setup() {
   // 3. Initialize tank calculator with loaded settings
   setupTankCalculator();
   
-  // 4. Initialize ultrasonic sensor
+  // 4. Initialize air temperature source and ultrasonic sensor
+  setupTemperature();
   setupSensor();      
+  setupAdaptiveSampler();
+  setupHistory();
   
-  // 5. Start web server
+  // 5. Restore state kept across deep sleep, then measure right away
+  setupPowerManager();
+  if (lowPowerMode) {
+    startSensorReading();
+    previousReadMillis = millis();
+  }
+  
+  // 6. Start web server
   setupWebServer();  
   
   Serial.println("Initialization complete. System ready.");
@@ -67,26 +87,53 @@ void loop() {
   // Process WiFi events and maintain connection
   wifiManager.process();
   
-  // Handle web server requests
+  // Run deferred web server work (requests are served asynchronously)
   handleWebServer();
   
+  // Commit settings changes once they have settled
+  processSettings();
+  processLiveSocket();
+  
+  // Track air temperature for the speed of sound
+  updateTemperature();
+  
+  // Keep the history clock in step with NTP
+  processHistory();
+  
   // Read sensor at regular intervals, using the user-defined interval
+  // (shortened by the adaptive sampler while the level is changing)
   unsigned long currentMillis = millis();
-  if (currentMillis - previousReadMillis >= (measurementInterval * 1000)) {
+  if (currentMillis - previousReadMillis >= getSampleInterval()) {
     previousReadMillis = currentMillis;
     
-    // Read water level from sensor
-    readSensorDistance();
-    
+    // Start a new measurement (echoes are collected by interrupt)
+    startSensorReading();
+  }
+  
+  // Advance the measurement one step so sampling interleaves with web serving
+  if (sensorTick()) {
     // Calculate water level and volume based on sensor reading
     calculateWaterLevel();
+    
+    // Keep the level for trends
+    recordHistory();
+    
+    // Push the new values to live dashboards
+    publishTankData();
+    publishLiveData();
+    
+    // Pick the next sampling period from the rate of change
+    updateSampleInterval(currentLevelRate);
   }
   
+  // Go back to deep sleep once the wake cycle is done (low-power mode)
+  processPowerManager();
+  
   // Update web clients at regular intervals (if needed)
   if (currentMillis - previousUpdateMillis >= webUpdateInterval) {
     previousUpdateMillis = currentMillis;
     
     // Any periodic web updates can go here
-    // (The main sensor data is sent when clients request it)
+    // (Sensor data is pushed to /events subscribers and served on request)
   }
 }
\ No newline at end of file
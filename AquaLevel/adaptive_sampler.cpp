@@ -0,0 +1,59 @@
+#include <Arduino.h>
+#include "config.h"
+#include "adaptive_sampler.h"
+
+// Current sampling period in milliseconds
+static float sampleIntervalMs = DEFAULT_MEASUREMENT_INTERVAL * 1000.0;
+
+// Slowest period: the user-defined measurement interval
+static float slowIntervalMs() {
+  return measurementInterval * 1000.0;
+}
+
+// Fastest period, never slower than the slowest one
+static float fastIntervalMs() {
+  return min((float)fastMeasurementInterval, slowIntervalMs());
+}
+
+void setupAdaptiveSampler() {
+  sampleIntervalMs = slowIntervalMs();
+  
+  Serial.println("Adaptive sampling: " + String(adaptiveSampling ? "Enabled" : "Disabled") +
+                 " (" + String((int)fastIntervalMs()) + " ms - " + String((int)slowIntervalMs()) + " ms)");
+}
+
+void updateSampleInterval(float levelRate) {
+  if (!adaptiveSampling) {
+    sampleIntervalMs = slowIntervalMs();
+    return;
+  }
+  
+  float rate = fabs(levelRate);
+  float fast = fastIntervalMs();
+  float slow = slowIntervalMs();
+  
+  // Map the rate onto the period range: idle -> slow, active -> fast
+  float target;
+  if (rate >= ADAPTIVE_ACTIVE_RATE) {
+    target = fast;
+  } else if (rate <= ADAPTIVE_IDLE_RATE) {
+    target = slow;
+  } else {
+    float position = (rate - ADAPTIVE_IDLE_RATE) / (ADAPTIVE_ACTIVE_RATE - ADAPTIVE_IDLE_RATE);
+    target = slow - position * (slow - fast);
+  }
+  
+  // React to a fill or drain at once, but back off gradually when it stops
+  if (target < sampleIntervalMs) {
+    sampleIntervalMs = target;
+  } else {
+    sampleIntervalMs = min(target, sampleIntervalMs * (float)ADAPTIVE_SLOWDOWN_FACTOR);
+  }
+}
+
+unsigned long getSampleInterval() {
+  if (!adaptiveSampling) {
+    return measurementInterval * 1000UL;
+  }
+  return (unsigned long)constrain(sampleIntervalMs, fastIntervalMs(), slowIntervalMs());
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+// adaptive_sampler.h
+#ifndef ADAPTIVE_SAMPLER_H
+#define ADAPTIVE_SAMPLER_H
+
+/**
+ * Initialize the adaptive sampler at the configured measurement interval
+ */
+void setupAdaptiveSampler();
+
+/**
+ * Pick the next sampling period from the current rate of change
+ * Speeds up immediately when the level moves and slows down gradually
+ * @param levelRate Water level rate of change in cm/minute
+ */
+void updateSampleInterval(float levelRate);
+
+/**
+ * Get the sampling period to use for the next measurement
+ * @return Milliseconds between measurements
+ */
+unsigned long getSampleInterval();
+
+#endif // ADAPTIVE_SAMPLER_H
\ No newline at end of file
@@ -9,8 +9,10 @@
 // 🛠 Sensor Config
 #define TRIGGER_PIN 1    // HC-SR04 Trigger pin
 #define ECHO_PIN 3    // HC-SR04 Echo pin
+// #define TEMPERATURE_SENSOR_PIN 4  // Optional DS18B20 (1-Wire) for air temperature under the lid
+#define TEMPERATURE_READ_INTERVAL 30  // seconds between air temperature readings
 #define EEPROM_INITIALIZED_MARKER 123
-#define EEPROM_SIZE 512  // Space for settings
+#define EEPROM_SIZE 1280  // Legacy layout (0-511) plus the config journals, read to migrate
 
 // Tank default parameters (cm for dimensions)
 #define DEFAULT_TANK_HEIGHT 100         // cm
@@ -21,6 +23,32 @@
 #define DEFAULT_FULL_DISTANCE 5         // cm (distance from sensor to water when full)
 #define DEFAULT_MEASUREMENT_INTERVAL 5  // seconds between measurements
 #define DEFAULT_READING_SMOOTHING 5     // number of readings to average
+#define MAX_READING_SMOOTHING 50        // capacity of the smoothing buffer
+#define DEFAULT_FILTER_WINDOW 3         // shots in the streaming median window
+#define DEFAULT_HAMPEL_THRESHOLD 3.0    // outlier threshold in scaled MADs (0 = off)
+#define DEFAULT_LEVEL_TRACKER false     // use the Kalman tracker instead of the moving average for the level
+#define DEFAULT_AIR_TEMPERATURE 20      // C, used for the speed of sound without a temperature sensor
+#define DEFAULT_ADAPTIVE_SAMPLING false // speed up sampling while the level is changing
+#define DEFAULT_FAST_MEASUREMENT_INTERVAL 500  // ms between measurements while the level is changing
+#define MIN_FAST_MEASUREMENT_INTERVAL 200      // ms, leaves room for a full 3-shot measurement
+#define DEFAULT_LOW_POWER_MODE false    // deep sleep for measurementInterval between measurements
+
+// Low-power (deep sleep) mode
+#define LOW_POWER_BOOT_WINDOW 300       // seconds awake after power-on, so settings stay reachable
+#define LOW_POWER_AWAKE_WINDOW 10       // seconds awake after each measurement for clients to poll
+
+// Adaptive sampling thresholds (water level rate of change)
+#define ADAPTIVE_IDLE_RATE 1.5          // cm/min, at or below: sample at measurementInterval
+#define ADAPTIVE_ACTIVE_RATE 5.0        // cm/min, at or above: sample at fastMeasurementInterval
+#define ADAPTIVE_SLOWDOWN_FACTOR 1.5    // max growth of the period per measurement
+
+// Level tracker (constant-velocity Kalman filter) tuning
+#define LEVEL_TRACKER_PROCESS_NOISE 0.00002  // cm^2/s^3, how quickly the fill rate may change
+#define LEVEL_TRACKER_MEASUREMENT_NOISE 0.25 // cm^2, variance of a median sample
+#define LEVEL_TRACKER_RESET_DISTANCE 25      // cm, jump that restarts the track
+
+// Shot outlier filter
+#define SENSOR_RESOLUTION 0.3           // cm, HC-SR04 ranging step; smallest sigma the Hampel test uses
 #define DEFAULT_ALERT_LEVEL_LOW 10      // percentage for low water alert
 #define DEFAULT_ALERT_LEVEL_HIGH 90     // percentage for high water alert
 #define DEFAULT_ALERTS_ENABLED true     // enable/disable alerts
@@ -41,6 +69,13 @@ extern float emptyDistance;      // Distance reading when tank is empty
 extern float fullDistance;       // Distance reading when tank is full
 extern int measurementInterval;  // Time between measurements in seconds
 extern int readingSmoothing;     // Number of readings to average
+extern int filterWindow;         // Shots in the streaming median window
+extern float hampelThreshold;    // Hampel outlier threshold (0 = disabled)
+extern bool levelTrackerEnabled; // Derive level from the tracker instead of the moving average
+extern int airTemperature;       // Configured air temperature in C (no sensor fitted)
+extern bool adaptiveSampling;    // Vary the sampling period with the rate of change
+extern int fastMeasurementInterval; // Fastest sampling period in milliseconds
+extern bool lowPowerMode;        // Deep sleep between measurements
 extern int alertLevelLow;        // Low water alert percentage
 extern int alertLevelHigh;       // High water alert percentage
 extern bool alertsEnabled;       // Enable/disable alerts
@@ -50,8 +85,18 @@ extern float currentDistance;    // Current distance reading from sensor
 extern float currentWaterLevel;  // Current water level in cm
 extern float currentPercentage;  // Current water percentage (0-100)
 extern float currentVolume;      // Current water volume in liters
+extern float trackedDistance;    // Kalman-tracked distance in cm
+extern float distanceRate;       // Tracked distance rate in cm/s (positive = draining)
+extern float currentFillRate;    // Fill rate in liters/minute (negative = draining)
+extern float currentLevelRate;   // Water level rate in cm/minute (negative = draining)
+extern float currentAirTemperature; // Air temperature used for the speed of sound in C
 
-// EEPROM memory layout
+// Legacy EEPROM memory layout
+// Configuration is kept in NVS under typed keys (see config_store.h); the
+// emulated EEPROM below is only read once, to migrate devices that still have
+// one. Newest first: the rotating journals from EEPROM_JOURNAL_START (see
+// config_journal.h), a versioned settings record or the EEPROM_ADDR_* fields
+// at EEPROM_SYSTEM_START, and the WiFi block at EEPROM_WIFI_START
 #define EEPROM_SYSTEM_START     0
 #define EEPROM_ADDR_MARKER      (EEPROM_SYSTEM_START + 0)
 #define EEPROM_ADDR_TANK_HEIGHT_L (EEPROM_SYSTEM_START + 1)
@@ -72,6 +117,14 @@ extern float currentVolume;      // Current water volume in liters
 #define EEPROM_ADDR_ALERT_LEVEL_HIGH (EEPROM_SYSTEM_START + 16)
 #define EEPROM_ADDR_ALERTS_ENABLED (EEPROM_SYSTEM_START + 17)
 #define EEPROM_ADDR_CRC (EEPROM_SYSTEM_START + 18)
+#define EEPROM_ADDR_FILTER_WINDOW (EEPROM_SYSTEM_START + 19)
+#define EEPROM_ADDR_HAMPEL_THRESHOLD (EEPROM_SYSTEM_START + 20)
+#define EEPROM_ADDR_LEVEL_TRACKER (EEPROM_SYSTEM_START + 21)
+#define EEPROM_ADDR_AIR_TEMPERATURE (EEPROM_SYSTEM_START + 22)
+#define EEPROM_ADDR_ADAPTIVE_SAMPLING (EEPROM_SYSTEM_START + 23)
+#define EEPROM_ADDR_FAST_INTERVAL_L (EEPROM_SYSTEM_START + 24)
+#define EEPROM_ADDR_FAST_INTERVAL_H (EEPROM_SYSTEM_START + 25)
+#define EEPROM_ADDR_LOW_POWER_MODE (EEPROM_SYSTEM_START + 26)
 
 // WiFi credentials section (100-299) - using the same layout as original project
 #define EEPROM_WIFI_START        100
@@ -79,5 +132,19 @@ extern float currentVolume;      // Current water volume in liters
 #define EEPROM_WIFI_PASS_ADDR    (EEPROM_WIFI_SSID_ADDR + MAX_SSID_LENGTH)
 #define EEPROM_DEVICE_NAME_ADDR  (EEPROM_WIFI_PASS_ADDR + MAX_PASSWORD_LENGTH)
 #define EEPROM_WIFI_MODE_ADDR    (EEPROM_DEVICE_NAME_ADDR + MAX_DEVICE_NAME_LENGTH)
+#define EEPROM_WIFI_CACHE_ADDR   (EEPROM_WIFI_MODE_ADDR + 1)       // marker + WifiConnectionCache
+#define EEPROM_STATIC_IP_ADDR    (EEPROM_WIFI_CACHE_ADDR + 1 + 32) // marker + StaticIPConfig
+
+// Config journals (512-1271): slots x slot size, 16 byte slot header included
+#define EEPROM_JOURNAL_START            512
+#define EEPROM_SETTINGS_JOURNAL_ADDR    (EEPROM_JOURNAL_START)
+#define EEPROM_SETTINGS_JOURNAL_SLOTS   3
+#define EEPROM_SETTINGS_JOURNAL_SLOT_SIZE 96
+#define EEPROM_WIFI_JOURNAL_ADDR        (EEPROM_SETTINGS_JOURNAL_ADDR + EEPROM_SETTINGS_JOURNAL_SLOTS * EEPROM_SETTINGS_JOURNAL_SLOT_SIZE)
+#define EEPROM_WIFI_JOURNAL_SLOTS       2
+#define EEPROM_WIFI_JOURNAL_SLOT_SIZE   176
+#define EEPROM_CACHE_JOURNAL_ADDR       (EEPROM_WIFI_JOURNAL_ADDR + EEPROM_WIFI_JOURNAL_SLOTS * EEPROM_WIFI_JOURNAL_SLOT_SIZE)
+#define EEPROM_CACHE_JOURNAL_SLOTS      3
+#define EEPROM_CACHE_JOURNAL_SLOT_SIZE  40
 
 #endif // CONFIG_H
\ No newline at end of file
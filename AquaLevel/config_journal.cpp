@@ -0,0 +1,85 @@
+#include <EEPROM.h>
+#include <Arduino.h>
+#include <esp_rom_crc.h>
+#include "config_journal.h"
+
+// In front of every slot; the CRC covers the sequence, version, length and data
+struct __attribute__((packed)) JournalSlotHeader {
+  uint32_t magic;
+  uint32_t sequence;
+  uint16_t version;
+  uint16_t length;
+  uint32_t crc;
+};
+
+static_assert(sizeof(JournalSlotHeader) == CONFIG_JOURNAL_HEADER_SIZE, "Slot header size changed");
+
+ConfigJournal::ConfigJournal(int address, uint8_t slots, size_t slotSize, uint32_t magic)
+  : _address(address), _slots(slots), _slotSize(slotSize), _magic(magic) {
+}
+
+size_t ConfigJournal::capacity() const {
+  return _slotSize - sizeof(JournalSlotHeader);
+}
+
+static uint32_t slotCrc(const JournalSlotHeader& header, const uint8_t* data) {
+  uint32_t crc = esp_rom_crc32_le(0, (const uint8_t*)&header.sequence,
+                                  sizeof(header.sequence) + sizeof(header.version) + sizeof(header.length));
+  return esp_rom_crc32_le(crc, data, header.length);
+}
+
+bool ConfigJournal::validSlot(uint8_t slot, uint32_t& sequence) {
+  int address = _address + slot * _slotSize;
+  JournalSlotHeader header;
+  EEPROM.get(address, header);
+
+  if (header.magic != _magic || header.length > capacity()) {
+    return false;
+  }
+
+  // The EEPROM mirror is in RAM, so check the data in place
+  const uint8_t* data = EEPROM.getDataPtr() + address + sizeof(header);
+  if (slotCrc(header, data) != header.crc) {
+    return false;
+  }
+
+  sequence = header.sequence;
+  return true;
+}
+
+int ConfigJournal::findNewest(uint32_t& sequence) {
+  int newest = -1;
+
+  for (uint8_t slot = 0; slot < _slots; slot++) {
+    uint32_t slotSequence;
+    if (!validSlot(slot, slotSequence)) {
+      continue;
+    }
+
+    // Wrap-safe comparison
+    if (newest < 0 || (int32_t)(slotSequence - sequence) > 0) {
+      newest = slot;
+      sequence = slotSequence;
+    }
+  }
+
+  return newest;
+}
+
+size_t ConfigJournal::load(void* data, size_t size, uint16_t* version) {
+  uint32_t sequence;
+  int slot = findNewest(sequence);
+  if (slot < 0) {
+    return 0;
+  }
+
+  int address = _address + slot * _slotSize;
+  JournalSlotHeader header;
+  EEPROM.get(address, header);
+
+  EEPROM.readBytes(address + sizeof(header), data, min((size_t)header.length, size));
+  if (version) {
+    *version = header.version;
+  }
+  return header.length;
+}
\ No newline at end of file
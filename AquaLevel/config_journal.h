@@ -0,0 +1,46 @@
+// config_journal.h
+#ifndef CONFIG_JOURNAL_H
+#define CONFIG_JOURNAL_H
+
+#include <Arduino.h>
+
+// Bytes of each slot taken by the slot header
+#define CONFIG_JOURNAL_HEADER_SIZE 16
+
+/**
+ * Read-only access to a rotating journal of one configuration block in EEPROM
+ * Older firmware saved each copy to the slot after the newest one, tagged
+ * with a sequence number and a CRC32
+ * Loading picks the valid slot with the highest sequence number
+ * Configuration has since moved to config_store.h; journals are only read
+ * to migrate devices that kept their configuration in one
+ */
+class ConfigJournal {
+public:
+  /**
+   * @param address First EEPROM byte of the journal
+   * @param slots Number of slots (at least 2)
+   * @param slotSize Bytes per slot, header included
+   * @param magic Identifies this journal's slots
+   */
+  ConfigJournal(int address, uint8_t slots, size_t slotSize, uint32_t magic);
+
+  /**
+   * Copy the newest valid block into data (at most size bytes)
+   * @param version Receives the version the block was saved with (optional)
+   * @return Bytes the block holds, 0 if no slot is valid
+   */
+  size_t load(void* data, size_t size, uint16_t* version = nullptr);
+
+private:
+  int _address;
+  uint8_t _slots;
+  size_t _slotSize;
+  uint32_t _magic;
+
+  size_t capacity() const;
+  int findNewest(uint32_t& sequence);
+  bool validSlot(uint8_t slot, uint32_t& sequence);
+};
+
+#endif // CONFIG_JOURNAL_H
\ No newline at end of file
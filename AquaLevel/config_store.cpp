@@ -0,0 +1,251 @@
+#include <string.h>
+#include "config_store.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <Preferences.h>
+
+// Largest blob compared before writing; longer ones are always written
+#define NVS_COMPARE_MAX 64
+
+/**
+ * ConfigStore on an NVS namespace (via Preferences)
+ * NVS appends entries to its own wear-leveled pages, so only the keys that
+ * change are written and nothing is erased in place
+ */
+class NvsConfigStore : public ConfigStore {
+public:
+  explicit NvsConfigStore(const char* name) : _name(name), _open(false) {}
+
+  bool begin() override {
+    if (!_open) {
+      _open = _prefs.begin(_name, false);
+    }
+    return _open;
+  }
+
+  bool isKey(const char* key) override { return _prefs.isKey(key); }
+
+  float getFloat(const char* key, float defaultValue) override { return _prefs.getFloat(key, defaultValue); }
+  int32_t getInt(const char* key, int32_t defaultValue) override { return _prefs.getInt(key, defaultValue); }
+  uint32_t getUInt(const char* key, uint32_t defaultValue) override { return _prefs.getUInt(key, defaultValue); }
+  bool getBool(const char* key, bool defaultValue) override { return _prefs.getBool(key, defaultValue); }
+
+  // Preferences logs an error for every missing key it reads, so check first
+  size_t getString(const char* key, char* value, size_t size) override {
+    if (size == 0) {
+      return 0;
+    }
+    if (!_prefs.isKey(key)) {
+      value[0] = '\0';
+      return 0;
+    }
+    // Preferences refuses strings longer than the buffer, so truncate here instead
+    String stored = _prefs.getString(key, "");
+    strncpy(value, stored.c_str(), size - 1);
+    value[size - 1] = '\0';
+    return strlen(value);
+  }
+
+  size_t getBytes(const char* key, void* value, size_t size) override {
+    if (!_prefs.isKey(key)) {
+      return 0;
+    }
+    size_t length = _prefs.getBytesLength(key);
+    if (length == 0) {
+      return 0;
+    }
+    if (length <= size) {
+      return _prefs.getBytes(key, value, size);
+    }
+    uint8_t* stored = (uint8_t*)malloc(length);
+    if (!stored) {
+      return 0;
+    }
+    _prefs.getBytes(key, stored, length);
+    memcpy(value, stored, size);
+    free(stored);
+    return size;
+  }
+
+  // Each put first checks the stored value, so rewriting a setting is free
+  bool putFloat(const char* key, float value) override {
+    float stored;
+    if (_prefs.isKey(key) && _prefs.getBytes(key, &stored, sizeof(stored)) == sizeof(stored) &&
+        memcmp(&stored, &value, sizeof(value)) == 0) {
+      return true;
+    }
+    return _prefs.putFloat(key, value) == sizeof(value);
+  }
+
+  bool putInt(const char* key, int32_t value) override {
+    if (_prefs.isKey(key) && _prefs.getInt(key, ~value) == value) {
+      return true;
+    }
+    return _prefs.putInt(key, value) == sizeof(value);
+  }
+
+  bool putUInt(const char* key, uint32_t value) override {
+    if (_prefs.isKey(key) && _prefs.getUInt(key, ~value) == value) {
+      return true;
+    }
+    return _prefs.putUInt(key, value) == sizeof(value);
+  }
+
+  bool putBool(const char* key, bool value) override {
+    if (_prefs.isKey(key) && _prefs.getBool(key, !value) == value) {
+      return true;
+    }
+    return _prefs.putBool(key, value) > 0;
+  }
+
+  bool putString(const char* key, const char* value) override {
+    if (_prefs.isKey(key) && _prefs.getString(key, "") == value) {
+      return true;
+    }
+    // Preferences returns the length written and 0 on error, which an empty
+    // string cannot be told apart from; read that one back instead
+    if (value[0] == '\0') {
+      _prefs.putString(key, value);
+      return _prefs.isKey(key) && _prefs.getString(key, "?").length() == 0;
+    }
+    return _prefs.putString(key, value) > 0;
+  }
+
+  bool putBytes(const char* key, const void* value, size_t length) override {
+    uint8_t stored[NVS_COMPARE_MAX];
+    if (length <= sizeof(stored) && _prefs.isKey(key) && _prefs.getBytesLength(key) == length &&
+        _prefs.getBytes(key, stored, length) == length && memcmp(stored, value, length) == 0) {
+      return true;
+    }
+    return _prefs.putBytes(key, value, length) == length;
+  }
+
+  bool remove(const char* key) override { return !_prefs.isKey(key) || _prefs.remove(key); }
+  bool clear() override { return _prefs.clear(); }
+
+private:
+  const char* _name;
+  bool _open;
+  Preferences _prefs;
+};
+
+static NvsConfigStore settingsBackend("settings");
+static NvsConfigStore wifiBackend("wifi");
+#else
+static MemoryConfigStore settingsBackend;
+static MemoryConfigStore wifiBackend;
+#endif
+
+ConfigStore& settingsStore = settingsBackend;
+ConfigStore& wifiStore = wifiBackend;
+
+const MemoryConfigStore::Value* MemoryConfigStore::find(const char* key, ValueType type) const {
+  std::map<std::string, Value>::const_iterator it = _values.find(key);
+  if (it == _values.end() || it->second.type != type) {
+    return nullptr;
+  }
+  return &it->second;
+}
+
+bool MemoryConfigStore::put(const char* key, ValueType type, const void* data, size_t length) {
+  const uint8_t* bytes = (const uint8_t*)data;
+  const Value* stored = find(key, type);
+
+  if (stored && stored->data.size() == length &&
+      (length == 0 || memcmp(stored->data.data(), bytes, length) == 0)) {
+    return true;
+  }
+
+  Value& value = _values[key];
+  value.type = type;
+  value.data.assign(bytes, bytes + length);
+  _writes++;
+  return true;
+}
+
+bool MemoryConfigStore::isKey(const char* key) {
+  return _values.count(key) > 0;
+}
+
+float MemoryConfigStore::getFloat(const char* key, float defaultValue) {
+  const Value* value = find(key, TYPE_FLOAT);
+  float result = defaultValue;
+  if (value) memcpy(&result, value->data.data(), sizeof(result));
+  return result;
+}
+
+int32_t MemoryConfigStore::getInt(const char* key, int32_t defaultValue) {
+  const Value* value = find(key, TYPE_INT);
+  int32_t result = defaultValue;
+  if (value) memcpy(&result, value->data.data(), sizeof(result));
+  return result;
+}
+
+uint32_t MemoryConfigStore::getUInt(const char* key, uint32_t defaultValue) {
+  const Value* value = find(key, TYPE_UINT);
+  uint32_t result = defaultValue;
+  if (value) memcpy(&result, value->data.data(), sizeof(result));
+  return result;
+}
+
+bool MemoryConfigStore::getBool(const char* key, bool defaultValue) {
+  const Value* value = find(key, TYPE_BOOL);
+  return value ? value->data[0] != 0 : defaultValue;
+}
+
+size_t MemoryConfigStore::getString(const char* key, char* value, size_t size) {
+  const Value* stored = find(key, TYPE_STRING);
+  if (!stored || size == 0) {
+    return 0;
+  }
+  size_t length = stored->data.size() < size - 1 ? stored->data.size() : size - 1;
+  memcpy(value, stored->data.data(), length);
+  value[length] = '\0';
+  return length;
+}
+
+size_t MemoryConfigStore::getBytes(const char* key, void* value, size_t size) {
+  const Value* stored = find(key, TYPE_BYTES);
+  if (!stored) {
+    return 0;
+  }
+  size_t length = stored->data.size() < size ? stored->data.size() : size;
+  memcpy(value, stored->data.data(), length);
+  return length;
+}
+
+bool MemoryConfigStore::putFloat(const char* key, float value) {
+  return put(key, TYPE_FLOAT, &value, sizeof(value));
+}
+
+bool MemoryConfigStore::putInt(const char* key, int32_t value) {
+  return put(key, TYPE_INT, &value, sizeof(value));
+}
+
+bool MemoryConfigStore::putUInt(const char* key, uint32_t value) {
+  return put(key, TYPE_UINT, &value, sizeof(value));
+}
+
+bool MemoryConfigStore::putBool(const char* key, bool value) {
+  uint8_t byte = value ? 1 : 0;
+  return put(key, TYPE_BOOL, &byte, sizeof(byte));
+}
+
+bool MemoryConfigStore::putString(const char* key, const char* value) {
+  return put(key, TYPE_STRING, value, strlen(value));
+}
+
+bool MemoryConfigStore::putBytes(const char* key, const void* value, size_t length) {
+  return put(key, TYPE_BYTES, value, length);
+}
+
+bool MemoryConfigStore::remove(const char* key) {
+  _writes += _values.erase(key);
+  return true;
+}
+
+bool MemoryConfigStore::clear() {
+  _writes += _values.size();
+  _values.clear();
+  return true;
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+// config_store.h
+#ifndef CONFIG_STORE_H
+#define CONFIG_STORE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * Typed key-value storage for one group of configuration (a namespace)
+ * Values are stored per key, so a change only rewrites the keys it touches;
+ * writing a value a key already holds does not touch storage
+ * Keys are at most 15 characters (the NVS limit)
+ */
+class ConfigStore {
+public:
+  virtual ~ConfigStore() {}
+
+  /**
+   * Open the namespace; must be called before any other method
+   * @return false if the backend is unavailable
+   */
+  virtual bool begin() = 0;
+
+  /**
+   * Check if a key has been written
+   */
+  virtual bool isKey(const char* key) = 0;
+
+  virtual float getFloat(const char* key, float defaultValue) = 0;
+  virtual int32_t getInt(const char* key, int32_t defaultValue) = 0;
+  virtual uint32_t getUInt(const char* key, uint32_t defaultValue) = 0;
+  virtual bool getBool(const char* key, bool defaultValue) = 0;
+
+  /**
+   * Copy a string into value (at most size bytes, always terminated)
+   * @return Length of the string, 0 if the key is missing
+   */
+  virtual size_t getString(const char* key, char* value, size_t size) = 0;
+
+  /**
+   * Copy a blob into value (at most size bytes)
+   * @return Bytes copied, 0 if the key is missing
+   */
+  virtual size_t getBytes(const char* key, void* value, size_t size) = 0;
+
+  /**
+   * Write a value; each returns false if it could not be stored
+   */
+  virtual bool putFloat(const char* key, float value) = 0;
+  virtual bool putInt(const char* key, int32_t value) = 0;
+  virtual bool putUInt(const char* key, uint32_t value) = 0;
+  virtual bool putBool(const char* key, bool value) = 0;
+  virtual bool putString(const char* key, const char* value) = 0;
+  virtual bool putBytes(const char* key, const void* value, size_t length) = 0;
+
+  /**
+   * Delete one key, or every key of the namespace
+   */
+  virtual bool remove(const char* key) = 0;
+  virtual bool clear() = 0;
+};
+
+/**
+ * ConfigStore kept in RAM, with the same typing rules as NVS (a key read as
+ * another type than it was written with returns the default)
+ * Has no Arduino dependencies, so code using a ConfigStore can be
+ * exercised on the host
+ */
+class MemoryConfigStore : public ConfigStore {
+public:
+  MemoryConfigStore() : _writes(0) {}
+
+  bool begin() override { return true; }
+  bool isKey(const char* key) override;
+
+  float getFloat(const char* key, float defaultValue) override;
+  int32_t getInt(const char* key, int32_t defaultValue) override;
+  uint32_t getUInt(const char* key, uint32_t defaultValue) override;
+  bool getBool(const char* key, bool defaultValue) override;
+  size_t getString(const char* key, char* value, size_t size) override;
+  size_t getBytes(const char* key, void* value, size_t size) override;
+
+  bool putFloat(const char* key, float value) override;
+  bool putInt(const char* key, int32_t value) override;
+  bool putUInt(const char* key, uint32_t value) override;
+  bool putBool(const char* key, bool value) override;
+  bool putString(const char* key, const char* value) override;
+  bool putBytes(const char* key, const void* value, size_t length) override;
+
+  bool remove(const char* key) override;
+  bool clear() override;
+
+  /**
+   * Number of writes that changed a value
+   */
+  size_t writes() const { return _writes; }
+
+private:
+  enum ValueType : uint8_t { TYPE_FLOAT, TYPE_INT, TYPE_UINT, TYPE_BOOL, TYPE_STRING, TYPE_BYTES };
+
+  struct Value {
+    ValueType type;
+    std::vector<uint8_t> data;
+  };
+
+  std::map<std::string, Value> _values;
+  size_t _writes;
+
+  const Value* find(const char* key, ValueType type) const;
+  bool put(const char* key, ValueType type, const void* data, size_t length);
+};
+
+/**
+ * Configuration namespaces, backed by NVS on the ESP32 and by RAM elsewhere
+ */
+extern ConfigStore& settingsStore;
+extern ConfigStore& wifiStore;
+
+#endif // CONFIG_STORE_H
\ No newline at end of file
@@ -1,7 +1,12 @@
 #include <EEPROM.h>
 #include <Arduino.h>
+#include <Preferences.h>
+#include <esp_rom_crc.h>
 #include "config.h"
+#include "config_journal.h"
+#include "config_store.h"
 #include "eeprom_manager.h"
+#include "median_filter.h"
 
 // 📌 Global Variables (defined in main file, declared in config.h)
 float tankHeight = DEFAULT_TANK_HEIGHT;
@@ -12,6 +17,13 @@ float emptyDistance = DEFAULT_EMPTY_DISTANCE;
 float fullDistance = DEFAULT_FULL_DISTANCE;
 int measurementInterval = DEFAULT_MEASUREMENT_INTERVAL;
 int readingSmoothing = DEFAULT_READING_SMOOTHING;
+int filterWindow = DEFAULT_FILTER_WINDOW;
+float hampelThreshold = DEFAULT_HAMPEL_THRESHOLD;
+bool levelTrackerEnabled = DEFAULT_LEVEL_TRACKER;
+int airTemperature = DEFAULT_AIR_TEMPERATURE;
+bool adaptiveSampling = DEFAULT_ADAPTIVE_SAMPLING;
+int fastMeasurementInterval = DEFAULT_FAST_MEASUREMENT_INTERVAL;
+bool lowPowerMode = DEFAULT_LOW_POWER_MODE;
 int alertLevelLow = DEFAULT_ALERT_LEVEL_LOW;
 int alertLevelHigh = DEFAULT_ALERT_LEVEL_HIGH;
 bool alertsEnabled = DEFAULT_ALERTS_ENABLED;
@@ -21,94 +33,188 @@ float currentDistance = 0.0;
 float currentWaterLevel = 0.0;
 float currentPercentage = 0.0;
 float currentVolume = 0.0;
+float trackedDistance = 0.0;
+float distanceRate = 0.0;
+float currentFillRate = 0.0;
+float currentLevelRate = 0.0;
+float currentAirTemperature = DEFAULT_AIR_TEMPERATURE;
 
 void setupEEPROM() {
-  Serial.println("Initializing EEPROM...");
+  Serial.println("Initializing settings storage...");
   
-  // Initialize EEPROM with specified size
-  if (!EEPROM.begin(EEPROM_SIZE)) {
-    Serial.println("Failed to initialize EEPROM!");
+  if (!settingsStore.begin()) {
+    Serial.println("Failed to open settings storage!");
     delay(1000);
   }
   
   loadSettings();
 }
 
-// Simple CRC calculation
-byte calculateCRC() {
-  byte crc = 0;
-  
-  // XOR all setting values to form a simple checksum
-  // For float values, we convert to int first to simplify
-  crc ^= (int)tankHeight & 0xFF;
-  crc ^= ((int)tankHeight >> 8) & 0xFF;
-  crc ^= (int)tankDiameter & 0xFF;
-  crc ^= ((int)tankDiameter >> 8) & 0xFF;
-  crc ^= (int)tankVolume & 0xFF;
-  crc ^= ((int)tankVolume >> 8) & 0xFF;
-  crc ^= (int)sensorOffset & 0xFF;
-  crc ^= ((int)sensorOffset >> 8) & 0xFF;
-  crc ^= (int)emptyDistance & 0xFF;
-  crc ^= ((int)emptyDistance >> 8) & 0xFF;
-  crc ^= (int)fullDistance & 0xFF;
-  crc ^= ((int)fullDistance >> 8) & 0xFF;
-  crc ^= measurementInterval & 0xFF;
-  crc ^= readingSmoothing & 0xFF;
-  crc ^= alertLevelLow & 0xFF;
-  crc ^= alertLevelHigh & 0xFF;
-  crc ^= alertsEnabled ? 1 : 0;
-  
-  return crc;
+bool beginLegacyEEPROM() {
+  // The emulated EEPROM is one blob in its own NVS namespace; opening it
+  // when the blob does not exist would create it, so check first
+  Preferences legacy;
+  if (!legacy.begin("eeprom", true)) {
+    return false;
+  }
+  bool present = legacy.isKey("eeprom");
+  legacy.end();
+  
+  return present && EEPROM.begin(EEPROM_SIZE);
 }
 
-void saveSettings() {
-  // First byte as an initialization marker
-  EEPROM.write(EEPROM_ADDR_MARKER, EEPROM_INITIALIZED_MARKER);
-  
-  // Store actual values - converting floats to integers (x100) for storage
-  int tankHeightInt = (int)(tankHeight * 100);
-  EEPROM.write(EEPROM_ADDR_TANK_HEIGHT_L, tankHeightInt & 0xFF);
-  EEPROM.write(EEPROM_ADDR_TANK_HEIGHT_H, (tankHeightInt >> 8) & 0xFF);
-  
-  int tankDiameterInt = (int)(tankDiameter * 100);
-  EEPROM.write(EEPROM_ADDR_TANK_DIAMETER_L, tankDiameterInt & 0xFF);
-  EEPROM.write(EEPROM_ADDR_TANK_DIAMETER_H, (tankDiameterInt >> 8) & 0xFF);
-  
-  int tankVolumeInt = (int)(tankVolume * 10); // 1 decimal place precision
-  EEPROM.write(EEPROM_ADDR_TANK_VOLUME_L, tankVolumeInt & 0xFF);
-  EEPROM.write(EEPROM_ADDR_TANK_VOLUME_H, (tankVolumeInt >> 8) & 0xFF);
-  
-  int sensorOffsetInt = (int)(sensorOffset * 100);
-  EEPROM.write(EEPROM_ADDR_SENSOR_OFFSET_L, sensorOffsetInt & 0xFF);
-  EEPROM.write(EEPROM_ADDR_SENSOR_OFFSET_H, (sensorOffsetInt >> 8) & 0xFF);
-  
-  int emptyDistanceInt = (int)(emptyDistance * 100);
-  EEPROM.write(EEPROM_ADDR_EMPTY_DISTANCE_L, emptyDistanceInt & 0xFF);
-  EEPROM.write(EEPROM_ADDR_EMPTY_DISTANCE_H, (emptyDistanceInt >> 8) & 0xFF);
-  
-  int fullDistanceInt = (int)(fullDistance * 100);
-  EEPROM.write(EEPROM_ADDR_FULL_DISTANCE_L, fullDistanceInt & 0xFF);
-  EEPROM.write(EEPROM_ADDR_FULL_DISTANCE_H, (fullDistanceInt >> 8) & 0xFF);
-  
-  EEPROM.write(EEPROM_ADDR_MEASUREMENT_INTERVAL, measurementInterval);
-  EEPROM.write(EEPROM_ADDR_READING_SMOOTHING, readingSmoothing);
-  EEPROM.write(EEPROM_ADDR_ALERT_LEVEL_LOW, alertLevelLow);
-  EEPROM.write(EEPROM_ADDR_ALERT_LEVEL_HIGH, alertLevelHigh);
-  EEPROM.write(EEPROM_ADDR_ALERTS_ENABLED, alertsEnabled ? 1 : 0);
-  
-  // Calculate and store CRC
-  byte crc = calculateCRC();
-  EEPROM.write(EEPROM_ADDR_CRC, crc);
-  
-  // Commit the data to flash
-  // THIS IS CRITICAL FOR ESP32 - without this, data isn't actually saved to flash
-  if (EEPROM.commit()) {
-    Serial.println("EEPROM committed successfully");
-  } else {
-    Serial.println("ERROR: EEPROM commit failed");
+void endLegacyEEPROM() {
+  EEPROM.end();
+}
+
+// Settings keys; a key that is missing keeps its default, so keys can be
+// added freely. SETTINGS_SCHEMA is written last and marks a complete set
+#define SETTINGS_SCHEMA_KEY "schema"
+#define SETTINGS_SCHEMA 1
+
+void eraseLegacyEEPROM() {
+  // Not migrated yet (or the migration commit failed): the blob is still needed
+  if (!settingsStore.isKey(SETTINGS_SCHEMA_KEY)) {
+    return;
   }
   
-  Serial.println("Settings saved to EEPROM:");
+  Preferences legacy;
+  if (!legacy.begin("eeprom", true)) {
+    return;
+  }
+  bool present = legacy.isKey("eeprom");
+  legacy.end();
+  
+  if (present && legacy.begin("eeprom", false)) {
+    if (legacy.remove("eeprom")) {
+      Serial.println("Legacy EEPROM erased after migration");
+    }
+    legacy.end();
+  }
+}
+
+// Legacy settings record: the packed fields, written and read as one block.
+// Fields were only ever appended; older records are read as far as they go
+// and the newer fields keep their defaults. The record lived in a rotating
+// journal, and before that at SETTINGS_ADDR behind its own header
+#define SETTINGS_ADDR EEPROM_SYSTEM_START
+#define SETTINGS_MAGIC 0x53514C41   // "ALQS"; its first byte differs from the legacy marker
+#define SETTINGS_VERSION 1
+#define SETTINGS_MAX_LENGTH (EEPROM_WIFI_START - EEPROM_SYSTEM_START - sizeof(SettingsHeader))
+
+struct __attribute__((packed)) SettingsHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t length;   // Bytes of record data that follow
+  uint32_t crc;      // CRC32 of the record data
+};
+
+struct __attribute__((packed)) SettingsRecord {
+  float tankHeight;
+  float tankDiameter;
+  float tankVolume;
+  float sensorOffset;
+  float emptyDistance;
+  float fullDistance;
+  uint16_t measurementInterval;
+  uint8_t readingSmoothing;
+  uint8_t filterWindow;
+  float hampelThreshold;
+  uint8_t levelTrackerEnabled;
+  int8_t airTemperature;
+  uint8_t adaptiveSampling;
+  uint16_t fastMeasurementInterval;
+  uint8_t lowPowerMode;
+  uint8_t alertLevelLow;
+  uint8_t alertLevelHigh;
+  uint8_t alertsEnabled;
+};
+
+static_assert(sizeof(SettingsRecord) <= EEPROM_SETTINGS_JOURNAL_SLOT_SIZE - CONFIG_JOURNAL_HEADER_SIZE,
+              "Settings record does not fit a journal slot");
+
+static ConfigJournal settingsJournal(EEPROM_SETTINGS_JOURNAL_ADDR, EEPROM_SETTINGS_JOURNAL_SLOTS,
+                                     EEPROM_SETTINGS_JOURNAL_SLOT_SIZE, SETTINGS_MAGIC);
+
+// Changes are applied in RAM at once and committed after a quiet period
+#define SETTINGS_COMMIT_DELAY 2000        // ms without further changes
+#define SETTINGS_COMMIT_MAX_DELAY 30000   // ms at most while changes keep coming
+
+// Set from web server handlers, committed from the main loop
+static volatile bool settingsDirty = false;
+static volatile unsigned long firstChangeAt = 0;
+static volatile unsigned long lastChangeAt = 0;
+static uint32_t settingsCommits = 0;
+static uint32_t settingsCommitsSkipped = 0;
+
+// What the store holds, to skip commits that would not change anything
+static SettingsRecord committedRecord;
+static bool committedValid = false;
+
+static void toRecord(SettingsRecord& record) {
+  record.tankHeight = tankHeight;
+  record.tankDiameter = tankDiameter;
+  record.tankVolume = tankVolume;
+  record.sensorOffset = sensorOffset;
+  record.emptyDistance = emptyDistance;
+  record.fullDistance = fullDistance;
+  record.measurementInterval = measurementInterval;
+  record.readingSmoothing = readingSmoothing;
+  record.filterWindow = filterWindow;
+  record.hampelThreshold = hampelThreshold;
+  record.levelTrackerEnabled = levelTrackerEnabled;
+  record.airTemperature = airTemperature;
+  record.adaptiveSampling = adaptiveSampling;
+  record.fastMeasurementInterval = fastMeasurementInterval;
+  record.lowPowerMode = lowPowerMode;
+  record.alertLevelLow = alertLevelLow;
+  record.alertLevelHigh = alertLevelHigh;
+  record.alertsEnabled = alertsEnabled;
+}
+
+static void fromRecord(const SettingsRecord& record) {
+  tankHeight = record.tankHeight;
+  tankDiameter = record.tankDiameter;
+  tankVolume = record.tankVolume;
+  sensorOffset = record.sensorOffset;
+  emptyDistance = record.emptyDistance;
+  fullDistance = record.fullDistance;
+  measurementInterval = record.measurementInterval;
+  readingSmoothing = record.readingSmoothing;
+  filterWindow = record.filterWindow;
+  hampelThreshold = record.hampelThreshold;
+  levelTrackerEnabled = record.levelTrackerEnabled != 0;
+  airTemperature = record.airTemperature;
+  adaptiveSampling = record.adaptiveSampling != 0;
+  fastMeasurementInterval = record.fastMeasurementInterval;
+  lowPowerMode = record.lowPowerMode != 0;
+  alertLevelLow = record.alertLevelLow;
+  alertLevelHigh = record.alertLevelHigh;
+  alertsEnabled = record.alertsEnabled != 0;
+}
+
+static void loadDefaults() {
+  tankHeight = DEFAULT_TANK_HEIGHT;
+  tankDiameter = DEFAULT_TANK_DIAMETER;
+  tankVolume = DEFAULT_TANK_VOLUME;
+  sensorOffset = DEFAULT_SENSOR_OFFSET;
+  emptyDistance = DEFAULT_EMPTY_DISTANCE;
+  fullDistance = DEFAULT_FULL_DISTANCE;
+  measurementInterval = DEFAULT_MEASUREMENT_INTERVAL;
+  readingSmoothing = DEFAULT_READING_SMOOTHING;
+  filterWindow = DEFAULT_FILTER_WINDOW;
+  hampelThreshold = DEFAULT_HAMPEL_THRESHOLD;
+  levelTrackerEnabled = DEFAULT_LEVEL_TRACKER;
+  airTemperature = DEFAULT_AIR_TEMPERATURE;
+  adaptiveSampling = DEFAULT_ADAPTIVE_SAMPLING;
+  fastMeasurementInterval = DEFAULT_FAST_MEASUREMENT_INTERVAL;
+  lowPowerMode = DEFAULT_LOW_POWER_MODE;
+  alertLevelLow = DEFAULT_ALERT_LEVEL_LOW;
+  alertLevelHigh = DEFAULT_ALERT_LEVEL_HIGH;
+  alertsEnabled = DEFAULT_ALERTS_ENABLED;
+}
+
+static void printSettings() {
   Serial.println("Tank Height: " + String(tankHeight) + " cm");
   Serial.println("Tank Diameter: " + String(tankDiameter) + " cm");
   Serial.println("Tank Volume: " + String(tankVolume) + " L");
@@ -117,96 +223,242 @@ void saveSettings() {
   Serial.println("Full Distance: " + String(fullDistance) + " cm");
   Serial.println("Measurement Interval: " + String(measurementInterval) + " s");
   Serial.println("Reading Smoothing: " + String(readingSmoothing));
+  Serial.println("Filter Window: " + String(filterWindow));
+  Serial.println("Hampel Threshold: " + String(hampelThreshold));
+  Serial.println("Level Tracker: " + String(levelTrackerEnabled ? "Yes" : "No"));
+  Serial.println("Air Temperature: " + String(airTemperature) + " C");
+  Serial.println("Adaptive Sampling: " + String(adaptiveSampling ? "Yes" : "No"));
+  Serial.println("Fast Measurement Interval: " + String(fastMeasurementInterval) + " ms");
+  Serial.println("Low-Power Mode: " + String(lowPowerMode ? "Yes" : "No"));
   Serial.println("Alert Level Low: " + String(alertLevelLow) + "%");
   Serial.println("Alert Level High: " + String(alertLevelHigh) + "%");
   Serial.println("Alerts Enabled: " + String(alertsEnabled ? "Yes" : "No"));
 }
 
-void loadSettings() {
-  // Check if EEPROM has been initialized with our marker
-  byte initialized = EEPROM.read(EEPROM_ADDR_MARKER);
+// Read the settings keys; missing keys keep their current (default) values
+static void loadSettingsStore() {
+  tankHeight = settingsStore.getFloat("tankHeight", tankHeight);
+  tankDiameter = settingsStore.getFloat("tankDiameter", tankDiameter);
+  tankVolume = settingsStore.getFloat("tankVolume", tankVolume);
+  sensorOffset = settingsStore.getFloat("sensorOffset", sensorOffset);
+  emptyDistance = settingsStore.getFloat("emptyDistance", emptyDistance);
+  fullDistance = settingsStore.getFloat("fullDistance", fullDistance);
+  measurementInterval = settingsStore.getInt("interval", measurementInterval);
+  readingSmoothing = settingsStore.getInt("smoothing", readingSmoothing);
+  filterWindow = settingsStore.getInt("filterWindow", filterWindow);
+  hampelThreshold = settingsStore.getFloat("hampel", hampelThreshold);
+  levelTrackerEnabled = settingsStore.getBool("levelTracker", levelTrackerEnabled);
+  airTemperature = settingsStore.getInt("airTemp", airTemperature);
+  adaptiveSampling = settingsStore.getBool("adaptive", adaptiveSampling);
+  fastMeasurementInterval = settingsStore.getInt("fastInterval", fastMeasurementInterval);
+  lowPowerMode = settingsStore.getBool("lowPower", lowPowerMode);
+  alertLevelLow = settingsStore.getInt("alertLow", alertLevelLow);
+  alertLevelHigh = settingsStore.getInt("alertHigh", alertLevelHigh);
+  alertsEnabled = settingsStore.getBool("alertsEnabled", alertsEnabled);
   
-  if (initialized == EEPROM_INITIALIZED_MARKER) {
-    // EEPROM has been initialized, load values
-    
-    // Read tank height (using 2 bytes for values that can exceed 255)
-    int tankHeightInt = EEPROM.read(EEPROM_ADDR_TANK_HEIGHT_L) | (EEPROM.read(EEPROM_ADDR_TANK_HEIGHT_H) << 8);
-    tankHeight = tankHeightInt / 100.0;
-    
-    // Read tank diameter (using 2 bytes)
-    int tankDiameterInt = EEPROM.read(EEPROM_ADDR_TANK_DIAMETER_L) | (EEPROM.read(EEPROM_ADDR_TANK_DIAMETER_H) << 8);
-    tankDiameter = tankDiameterInt / 100.0;
-    
-    // Read tank volume (using 2 bytes)
-    int tankVolumeInt = EEPROM.read(EEPROM_ADDR_TANK_VOLUME_L) | (EEPROM.read(EEPROM_ADDR_TANK_VOLUME_H) << 8);
-    tankVolume = tankVolumeInt / 10.0;
-    
-    // Read sensor offset (using 2 bytes)
-    int sensorOffsetInt = EEPROM.read(EEPROM_ADDR_SENSOR_OFFSET_L) | (EEPROM.read(EEPROM_ADDR_SENSOR_OFFSET_H) << 8);
-    sensorOffset = sensorOffsetInt / 100.0;
-    
-    // Read empty distance (using 2 bytes)
-    int emptyDistanceInt = EEPROM.read(EEPROM_ADDR_EMPTY_DISTANCE_L) | (EEPROM.read(EEPROM_ADDR_EMPTY_DISTANCE_H) << 8);
-    emptyDistance = emptyDistanceInt / 100.0;
-    
-    // Read full distance (using 2 bytes)
-    int fullDistanceInt = EEPROM.read(EEPROM_ADDR_FULL_DISTANCE_L) | (EEPROM.read(EEPROM_ADDR_FULL_DISTANCE_H) << 8);
-    fullDistance = fullDistanceInt / 100.0;
-    
-    measurementInterval = EEPROM.read(EEPROM_ADDR_MEASUREMENT_INTERVAL);
-    readingSmoothing = EEPROM.read(EEPROM_ADDR_READING_SMOOTHING);
-    alertLevelLow = EEPROM.read(EEPROM_ADDR_ALERT_LEVEL_LOW);
-    alertLevelHigh = EEPROM.read(EEPROM_ADDR_ALERT_LEVEL_HIGH);
-    alertsEnabled = EEPROM.read(EEPROM_ADDR_ALERTS_ENABLED) == 1;
-    
-    // Read stored CRC
-    byte storedCRC = EEPROM.read(EEPROM_ADDR_CRC);
-    
-    // Calculate CRC based on loaded values
-    byte calculatedCRC = calculateCRC();
-    
-    // Verify CRC
-    if (storedCRC == calculatedCRC) {
-      Serial.println("Settings loaded from EEPROM (CRC valid):");
-    } else {
-      Serial.println("WARNING: CRC mismatch, possible EEPROM corruption!");
-      Serial.println("Stored CRC: " + String(storedCRC) + ", Calculated: " + String(calculatedCRC));
-      // Continue using the loaded values, but warn the user
-    }
-    
-    Serial.println("Tank Height: " + String(tankHeight) + " cm");
-    Serial.println("Tank Diameter: " + String(tankDiameter) + " cm");
-    Serial.println("Tank Volume: " + String(tankVolume) + " L");
-    Serial.println("Sensor Offset: " + String(sensorOffset) + " cm");
-    Serial.println("Empty Distance: " + String(emptyDistance) + " cm");
-    Serial.println("Full Distance: " + String(fullDistance) + " cm");
-    Serial.println("Measurement Interval: " + String(measurementInterval) + " s");
-    Serial.println("Reading Smoothing: " + String(readingSmoothing));
-    Serial.println("Alert Level Low: " + String(alertLevelLow) + "%");
-    Serial.println("Alert Level High: " + String(alertLevelHigh) + "%");
-    Serial.println("Alerts Enabled: " + String(alertsEnabled ? "Yes" : "No"));
+  uint32_t schema = settingsStore.getUInt(SETTINGS_SCHEMA_KEY, SETTINGS_SCHEMA);
+  if (schema != SETTINGS_SCHEMA) {
+    Serial.println("Settings schema " + String(schema) + " read as schema " + String(SETTINGS_SCHEMA));
+  }
+}
+
+// Write the settings keys; the store only rewrites keys whose value changed
+static bool storeSettings() {
+  bool ok = true;
+  ok &= settingsStore.putFloat("tankHeight", tankHeight);
+  ok &= settingsStore.putFloat("tankDiameter", tankDiameter);
+  ok &= settingsStore.putFloat("tankVolume", tankVolume);
+  ok &= settingsStore.putFloat("sensorOffset", sensorOffset);
+  ok &= settingsStore.putFloat("emptyDistance", emptyDistance);
+  ok &= settingsStore.putFloat("fullDistance", fullDistance);
+  ok &= settingsStore.putInt("interval", measurementInterval);
+  ok &= settingsStore.putInt("smoothing", readingSmoothing);
+  ok &= settingsStore.putInt("filterWindow", filterWindow);
+  ok &= settingsStore.putFloat("hampel", hampelThreshold);
+  ok &= settingsStore.putBool("levelTracker", levelTrackerEnabled);
+  ok &= settingsStore.putInt("airTemp", airTemperature);
+  ok &= settingsStore.putBool("adaptive", adaptiveSampling);
+  ok &= settingsStore.putInt("fastInterval", fastMeasurementInterval);
+  ok &= settingsStore.putBool("lowPower", lowPowerMode);
+  ok &= settingsStore.putInt("alertLow", alertLevelLow);
+  ok &= settingsStore.putInt("alertHigh", alertLevelHigh);
+  ok &= settingsStore.putBool("alertsEnabled", alertsEnabled);
+  
+  // Only a complete set is marked; an interrupted first write is redone
+  return ok && settingsStore.putUInt(SETTINGS_SCHEMA_KEY, SETTINGS_SCHEMA);
+}
+
+// Fields from EEPROM_ADDR_FILTER_WINDOW on were added after the first release,
+// which never wrote them; they still hold the erased 0x00 or 0xFF there
+static bool readLegacyByte(int address, uint8_t& value) {
+  uint8_t stored = EEPROM.read(address);
+  if (stored == 0x00 || stored == 0xFF) {
+    return false;
+  }
+  value = stored;
+  return true;
+}
+
+// Read settings stored field by field at EEPROM_ADDR_* (before the versioned record)
+static bool loadLegacySettings() {
+  if (EEPROM.read(EEPROM_ADDR_MARKER) != EEPROM_INITIALIZED_MARKER) {
+    return false;
+  }
+  
+  // Floats were stored as 16 bit fixed point
+  tankHeight = (EEPROM.read(EEPROM_ADDR_TANK_HEIGHT_L) | (EEPROM.read(EEPROM_ADDR_TANK_HEIGHT_H) << 8)) / 100.0;
+  tankDiameter = (EEPROM.read(EEPROM_ADDR_TANK_DIAMETER_L) | (EEPROM.read(EEPROM_ADDR_TANK_DIAMETER_H) << 8)) / 100.0;
+  tankVolume = (EEPROM.read(EEPROM_ADDR_TANK_VOLUME_L) | (EEPROM.read(EEPROM_ADDR_TANK_VOLUME_H) << 8)) / 10.0;
+  sensorOffset = (EEPROM.read(EEPROM_ADDR_SENSOR_OFFSET_L) | (EEPROM.read(EEPROM_ADDR_SENSOR_OFFSET_H) << 8)) / 100.0;
+  emptyDistance = (EEPROM.read(EEPROM_ADDR_EMPTY_DISTANCE_L) | (EEPROM.read(EEPROM_ADDR_EMPTY_DISTANCE_H) << 8)) / 100.0;
+  fullDistance = (EEPROM.read(EEPROM_ADDR_FULL_DISTANCE_L) | (EEPROM.read(EEPROM_ADDR_FULL_DISTANCE_H) << 8)) / 100.0;
+  
+  measurementInterval = EEPROM.read(EEPROM_ADDR_MEASUREMENT_INTERVAL);
+  readingSmoothing = EEPROM.read(EEPROM_ADDR_READING_SMOOTHING);
+  alertLevelLow = EEPROM.read(EEPROM_ADDR_ALERT_LEVEL_LOW);
+  alertLevelHigh = EEPROM.read(EEPROM_ADDR_ALERT_LEVEL_HIGH);
+  alertsEnabled = EEPROM.read(EEPROM_ADDR_ALERTS_ENABLED) == 1;
+  
+  // Later fields keep their defaults where they were never written (a threshold
+  // of 0 or a temperature of 0 or -1 C cannot be told apart from that)
+  uint8_t value;
+  if (readLegacyByte(EEPROM_ADDR_FILTER_WINDOW, value)) filterWindow = value;
+  if (readLegacyByte(EEPROM_ADDR_HAMPEL_THRESHOLD, value)) hampelThreshold = value / 10.0;
+  if (readLegacyByte(EEPROM_ADDR_LEVEL_TRACKER, value)) levelTrackerEnabled = value == 1;
+  if (readLegacyByte(EEPROM_ADDR_AIR_TEMPERATURE, value)) airTemperature = (int8_t)value;
+  if (readLegacyByte(EEPROM_ADDR_ADAPTIVE_SAMPLING, value)) adaptiveSampling = value == 1;
+  if (readLegacyByte(EEPROM_ADDR_LOW_POWER_MODE, value)) lowPowerMode = value == 1;
+  
+  uint16_t fastInterval = EEPROM.read(EEPROM_ADDR_FAST_INTERVAL_L) | (EEPROM.read(EEPROM_ADDR_FAST_INTERVAL_H) << 8);
+  if (fastInterval != 0x0000 && fastInterval != 0xFFFF) {
+    fastMeasurementInterval = fastInterval;
+  }
+  return true;
+}
+
+// Read the newest valid journal slot
+static bool loadSettingsJournal() {
+  // Fields the stored version does not have keep their current (default) values
+  SettingsRecord record;
+  toRecord(record);
+  
+  uint16_t version;
+  if (settingsJournal.load(&record, sizeof(record), &version) == 0) {
+    return false;
+  }
+  fromRecord(record);
+  
+  if (version != SETTINGS_VERSION) {
+    Serial.println("Settings record version " + String(version) + " read as version " + String(SETTINGS_VERSION));
+  }
+  return true;
+}
+
+// Read the versioned record stored in place at SETTINGS_ADDR (before the journal)
+static bool loadSettingsRecord() {
+  SettingsHeader header;
+  EEPROM.get(SETTINGS_ADDR, header);
+  
+  if (header.magic != SETTINGS_MAGIC || header.length == 0 || header.length > SETTINGS_MAX_LENGTH) {
+    return false;
+  }
+  
+  uint8_t data[SETTINGS_MAX_LENGTH];
+  EEPROM.readBytes(SETTINGS_ADDR + sizeof(header), data, header.length);
+  if (esp_rom_crc32_le(0, data, header.length) != header.crc) {
+    Serial.println("WARNING: Settings CRC mismatch, record ignored");
+    return false;
+  }
+  
+  // Fields the stored version does not have keep their current (default) values
+  SettingsRecord record;
+  toRecord(record);
+  memcpy(&record, data, min((size_t)header.length, sizeof(record)));
+  fromRecord(record);
+  
+  if (header.version != SETTINGS_VERSION) {
+    Serial.println("Settings record version " + String(header.version) + " read as version " + String(SETTINGS_VERSION));
+  }
+  return true;
+}
+
+// Write the settings to the store unless it already holds them
+static void commitSettings() {
+  settingsDirty = false;
+  
+  SettingsRecord record;
+  toRecord(record);
+  
+  if (committedValid && memcmp(&record, &committedRecord, sizeof(record)) == 0) {
+    settingsCommitsSkipped++;
+    Serial.println("Settings unchanged, commit skipped");
+    return;
+  }
+  
+  if (storeSettings()) {
+    committedRecord = record;
+    committedValid = true;
+    settingsCommits++;
+    Serial.println("Settings committed successfully");
   } else {
-    // EEPROM hasn't been initialized, set defaults
-    tankHeight = DEFAULT_TANK_HEIGHT;
-    tankDiameter = DEFAULT_TANK_DIAMETER;
-    tankVolume = DEFAULT_TANK_VOLUME;
-    sensorOffset = DEFAULT_SENSOR_OFFSET;
-    emptyDistance = DEFAULT_EMPTY_DISTANCE;
-    fullDistance = DEFAULT_FULL_DISTANCE;
-    measurementInterval = DEFAULT_MEASUREMENT_INTERVAL;
-    readingSmoothing = DEFAULT_READING_SMOOTHING;
-    alertLevelLow = DEFAULT_ALERT_LEVEL_LOW;
-    alertLevelHigh = DEFAULT_ALERT_LEVEL_HIGH;
-    alertsEnabled = DEFAULT_ALERTS_ENABLED;
-    
-    Serial.println("Using default settings (EEPROM not initialized or corrupted)");
-    Serial.println("EEPROM marker: " + String(initialized) + " (expected: " + String(EEPROM_INITIALIZED_MARKER) + ")");
-    
-    // Save defaults to EEPROM for future use
-    saveSettings();
+    Serial.println("ERROR: Settings commit failed");
+  }
+  
+  Serial.println("Settings saved:");
+  printSettings();
+}
+
+// Settings from the emulated EEPROM, newest format first
+static bool migrateLegacySettings() {
+  if (!beginLegacyEEPROM()) {
+    return false;
+  }
+  bool found = loadSettingsJournal() || loadSettingsRecord() || loadLegacySettings();
+  endLegacyEEPROM();
+  return found;
+}
+
+void saveSettings() {
+  unsigned long now = millis();
+  if (!settingsDirty) {
+    firstChangeAt = now;
+  }
+  lastChangeAt = now;
+  settingsDirty = true;
+}
+
+void processSettings() {
+  if (!settingsDirty) {
+    return;
   }
   
-  // Validate values to prevent issues
+  // Wait for a burst of changes to settle, but not forever
+  unsigned long now = millis();
+  if (now - lastChangeAt >= SETTINGS_COMMIT_DELAY || now - firstChangeAt >= SETTINGS_COMMIT_MAX_DELAY) {
+    commitSettings();
+  }
+}
+
+void flushSettings() {
+  if (settingsDirty) {
+    commitSettings();
+  }
+}
+
+bool settingsPending() {
+  return settingsDirty;
+}
+
+uint32_t getSettingsCommitCount() {
+  return settingsCommits;
+}
+
+uint32_t getSettingsSkippedCommitCount() {
+  return settingsCommitsSkipped;
+}
+
+// Replace out-of-range values with their defaults
+static void validateSettings() {
   if (tankHeight <= 0 || tankHeight > 1000) tankHeight = DEFAULT_TANK_HEIGHT;
   if (tankDiameter <= 0 || tankDiameter > 1000) tankDiameter = DEFAULT_TANK_DIAMETER;
   if (tankVolume <= 0 || tankVolume > 100000) tankVolume = DEFAULT_TANK_VOLUME;
@@ -214,7 +466,45 @@ void loadSettings() {
   if (emptyDistance <= 0 || emptyDistance > 500) emptyDistance = DEFAULT_EMPTY_DISTANCE;
   if (fullDistance < 0 || fullDistance > emptyDistance) fullDistance = DEFAULT_FULL_DISTANCE;
   if (measurementInterval < 1 || measurementInterval > 3600) measurementInterval = DEFAULT_MEASUREMENT_INTERVAL;
-  if (readingSmoothing < 1 || readingSmoothing > 50) readingSmoothing = DEFAULT_READING_SMOOTHING;
+  if (readingSmoothing < 1 || readingSmoothing > MAX_READING_SMOOTHING) readingSmoothing = DEFAULT_READING_SMOOTHING;
+  if (filterWindow < 1 || filterWindow > MAX_FILTER_WINDOW) filterWindow = DEFAULT_FILTER_WINDOW;
+  if (hampelThreshold < 0 || hampelThreshold > 10) hampelThreshold = DEFAULT_HAMPEL_THRESHOLD;
+  if (airTemperature < -40 || airTemperature > 85) airTemperature = DEFAULT_AIR_TEMPERATURE;
+  if (fastMeasurementInterval < MIN_FAST_MEASUREMENT_INTERVAL || fastMeasurementInterval > 60000) fastMeasurementInterval = DEFAULT_FAST_MEASUREMENT_INTERVAL;
   if (alertLevelLow < 0 || alertLevelLow > 100) alertLevelLow = DEFAULT_ALERT_LEVEL_LOW;
   if (alertLevelHigh < 0 || alertLevelHigh > 100) alertLevelHigh = DEFAULT_ALERT_LEVEL_HIGH;
+}
+
+void loadSettings() {
+  loadDefaults();
+  
+  // Values are validated before anything is committed, so the store never
+  // keeps what validation replaces
+  if (settingsStore.isKey(SETTINGS_SCHEMA_KEY)) {
+    loadSettingsStore();
+    toRecord(committedRecord);
+    committedValid = true;
+    
+    validateSettings();
+    SettingsRecord record;
+    toRecord(record);
+    if (memcmp(&record, &committedRecord, sizeof(record)) != 0) {
+      Serial.println("Stored settings out of range, defaults restored");
+      commitSettings();
+    } else {
+      Serial.println("Settings loaded:");
+      printSettings();
+    }
+  } else if (migrateLegacySettings()) {
+    // One-time move to the store; the emulated EEPROM is not read again
+    Serial.println("Migrating settings from the legacy EEPROM layout");
+    validateSettings();
+    commitSettings();
+  } else {
+    Serial.println("Using default settings (no saved settings)");
+    
+    // Save defaults for future use
+    validateSettings();
+    commitSettings();
+  }
 }
\ No newline at end of file
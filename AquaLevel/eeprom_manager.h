@@ -2,19 +2,67 @@
 #ifndef EEPROM_MANAGER_H
 #define EEPROM_MANAGER_H
 
+#include <stdint.h>
+
 /**
- * Initializes the EEPROM module
+ * Opens the settings store (NVS, see config_store.h) and loads the settings
  */
 void setupEEPROM();
 
 /**
- * Saves all settings to EEPROM
+ * Maps the emulated EEPROM that older firmware kept its configuration in
+ * Only used for the one-time migration to the config store
+ * @return false if the device never had one
+ */
+bool beginLegacyEEPROM();
+
+/**
+ * Releases the emulated EEPROM mapped by beginLegacyEEPROM()
+ */
+void endLegacyEEPROM();
+
+/**
+ * Deletes the emulated EEPROM once the settings are in the config store
+ * Call after the WiFi configuration has been migrated too
+ */
+void eraseLegacyEEPROM();
+
+/**
+ * Marks the settings as changed; they are committed to the store by
+ * processSettings() once changes stop for a moment, so bursts of
+ * changes cost a single flash write
  */
 void saveSettings();
 
 /**
- * Loads all settings from EEPROM
- * If EEPROM has not been initialized, loads default settings
+ * Commits changed settings once the debounce delay has passed
+ * Should be called regularly in the main loop
+ */
+void processSettings();
+
+/**
+ * Commits changed settings now (before a restart or deep sleep)
+ */
+void flushSettings();
+
+/**
+ * Check if changed settings are waiting to be committed
+ */
+bool settingsPending();
+
+/**
+ * Number of settings commits that wrote flash since boot
+ */
+uint32_t getSettingsCommitCount();
+
+/**
+ * Number of settings commits skipped because nothing had changed
+ */
+uint32_t getSettingsSkippedCommitCount();
+
+/**
+ * Loads all settings from the store
+ * Migrates them from the legacy EEPROM on first boot, otherwise loads defaults
  */
 void loadSettings();
 
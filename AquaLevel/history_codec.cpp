@@ -0,0 +1,189 @@
+#include <string.h>
+#include "history_codec.h"
+
+// Delta-of-delta time codes: prefix, then the zigzag value in the given width
+//   0                 unchanged interval
+//   10   + 7 bits     small jitter
+//   110  + 9 bits
+//   1110 + 12 bits
+//   1111 + 32 bits    anything else (e.g. a gap)
+// Value delta codes:
+//   0                 unchanged
+//   10   + 4 bits
+//   110  + 8 bits
+//   111  + 16 bits    any other change
+
+static uint32_t zigzag(int32_t value) {
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static int32_t unzigzag(uint32_t value) {
+  return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+static uint8_t timeCodeBits(uint32_t zz) {
+  if (zz == 0) return 1;
+  if (zz < (1UL << 7)) return 2 + 7;
+  if (zz < (1UL << 9)) return 3 + 9;
+  if (zz < (1UL << 12)) return 4 + 12;
+  return 4 + 32;
+}
+
+static uint8_t valueCodeBits(uint32_t zz) {
+  if (zz == 0) return 1;
+  if (zz < (1UL << 4)) return 2 + 4;
+  if (zz < (1UL << 8)) return 3 + 8;
+  return 3 + 16;
+}
+
+HistoryEncoder::HistoryEncoder()
+  : _buffer(nullptr), _size(0), _channels(0), _bits(0), _count(0), _prevTime(0), _prevDelta(0) {
+}
+
+void HistoryEncoder::begin(uint8_t* buffer, size_t size, uint8_t channels, uint32_t baseTime) {
+  _buffer = buffer;
+  _size = size;
+  _channels = channels > HISTORY_CODEC_MAX_CHANNELS ? HISTORY_CODEC_MAX_CHANNELS : channels;
+  _bits = 0;
+  _count = 0;
+  _prevTime = baseTime;
+  _prevDelta = 0;
+  memset(_prev, 0, sizeof(_prev));
+}
+
+void HistoryEncoder::put(uint32_t value, uint8_t bits) {
+  while (bits > 0) {
+    bits--;
+    size_t index = _bits / 8;
+    uint8_t mask = 0x80 >> (_bits % 8);
+    if (value & (1UL << bits)) {
+      _buffer[index] |= mask;
+    } else {
+      _buffer[index] &= ~mask;
+    }
+    _bits++;
+  }
+}
+
+bool HistoryEncoder::add(uint32_t time, const uint16_t* values) {
+  if (!_buffer || _count == 0xFFFF) {
+    return false;
+  }
+
+  int32_t delta = (int32_t)(time - _prevTime);
+  uint32_t timeZz = zigzag(delta - _prevDelta);
+  uint32_t valueZz[HISTORY_CODEC_MAX_CHANNELS];
+
+  // Size the whole point first so a point never ends up half written
+  uint32_t needed = timeCodeBits(timeZz);
+  for (uint8_t i = 0; i < _channels; i++) {
+    valueZz[i] = zigzag((int16_t)(values[i] - _prev[i]));  // Modulo 2^16, so any change fits 16 bits
+    needed += valueCodeBits(valueZz[i]);
+  }
+  if (_bits + needed > _size * 8) {
+    return false;
+  }
+
+  if (timeZz == 0) {
+    put(0, 1);
+  } else if (timeZz < (1UL << 7)) {
+    put(0x2, 2);
+    put(timeZz, 7);
+  } else if (timeZz < (1UL << 9)) {
+    put(0x6, 3);
+    put(timeZz, 9);
+  } else if (timeZz < (1UL << 12)) {
+    put(0xE, 4);
+    put(timeZz, 12);
+  } else {
+    put(0xF, 4);
+    put(timeZz, 32);
+  }
+
+  for (uint8_t i = 0; i < _channels; i++) {
+    uint32_t zz = valueZz[i];
+    if (zz == 0) {
+      put(0, 1);
+    } else if (zz < (1UL << 4)) {
+      put(0x2, 2);
+      put(zz, 4);
+    } else if (zz < (1UL << 8)) {
+      put(0x6, 3);
+      put(zz, 8);
+    } else {
+      put(0x7, 3);
+      put(zz, 16);
+    }
+    _prev[i] = values[i];
+  }
+
+  _prevDelta = delta;
+  _prevTime = time;
+  _count++;
+  return true;
+}
+
+HistoryDecoder::HistoryDecoder(const uint8_t* buffer, size_t size, uint16_t count, uint8_t channels, uint32_t baseTime)
+  : _buffer(buffer), _size(size), _bit(0), _remaining(count), _prevTime(baseTime), _prevDelta(0) {
+  _channels = channels > HISTORY_CODEC_MAX_CHANNELS ? HISTORY_CODEC_MAX_CHANNELS : channels;
+  memset(_prev, 0, sizeof(_prev));
+}
+
+bool HistoryDecoder::get(uint8_t bits, uint32_t& value) {
+  if (_bit + bits > _size * 8) {
+    return false;
+  }
+
+  value = 0;
+  while (bits > 0) {
+    bits--;
+    value = (value << 1) | ((_buffer[_bit / 8] >> (7 - _bit % 8)) & 1);
+    _bit++;
+  }
+  return true;
+}
+
+bool HistoryDecoder::next(uint32_t& time, uint16_t* values) {
+  if (_remaining == 0) {
+    return false;
+  }
+
+  // Count the prefix ones (at most 4 for times, 3 for values)
+  uint32_t bit;
+  uint8_t ones = 0;
+  while (ones < 4) {
+    if (!get(1, bit)) return false;
+    if (!bit) break;
+    ones++;
+  }
+
+  static const uint8_t TIME_WIDTHS[] = {0, 7, 9, 12, 32};
+  uint32_t zz = 0;
+  if (ones > 0 && !get(TIME_WIDTHS[ones], zz)) {
+    return false;
+  }
+  int32_t delta = _prevDelta + unzigzag(zz);
+
+  static const uint8_t VALUE_WIDTHS[] = {0, 4, 8, 16};
+  for (uint8_t i = 0; i < _channels; i++) {
+    ones = 0;
+    while (ones < 3) {
+      if (!get(1, bit)) return false;
+      if (!bit) break;
+      ones++;
+    }
+
+    zz = 0;
+    if (ones > 0 && !get(VALUE_WIDTHS[ones], zz)) {
+      return false;
+    }
+    _prev[i] = (uint16_t)((int32_t)_prev[i] + unzigzag(zz));
+    values[i] = _prev[i];
+  }
+
+  _prevDelta = delta;
+  _prevTime += delta;
+  time = _prevTime;
+  _remaining--;
+  return true;
+}
\ No newline at end of file
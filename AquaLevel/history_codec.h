@@ -0,0 +1,78 @@
+// history_codec.h
+#ifndef HISTORY_CODEC_H
+#define HISTORY_CODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Most values per point (e.g. min, avg, max and sample count)
+#define HISTORY_CODEC_MAX_CHANNELS 4
+
+/**
+ * Bit-packed encoder for a block of timestamped points
+ * Times are stored as delta-of-delta against the previous interval, so a
+ * regular sampling period costs one bit per point; each value is stored as
+ * a zigzag delta from the previous point with short codes for small changes
+ * Points are appended until the buffer is full; nothing is ever rewritten
+ * Has no Arduino dependencies, so it can be exercised on the host
+ */
+class HistoryEncoder {
+public:
+  HistoryEncoder();
+
+  /**
+   * Start an empty block
+   * @param baseTime Time the first interval is measured from (usually the first point's time)
+   */
+  void begin(uint8_t* buffer, size_t size, uint8_t channels, uint32_t baseTime);
+
+  /**
+   * Append a point; times must not go backwards
+   * @return false if the point does not fit (the block is left unchanged)
+   */
+  bool add(uint32_t time, const uint16_t* values);
+
+  uint16_t count() const { return _count; }
+  size_t length() const { return (_bits + 7) / 8; }
+
+private:
+  uint8_t* _buffer;
+  size_t _size;
+  uint8_t _channels;
+  uint32_t _bits;
+  uint16_t _count;
+  uint32_t _prevTime;
+  int32_t _prevDelta;
+  uint16_t _prev[HISTORY_CODEC_MAX_CHANNELS];
+
+  void put(uint32_t value, uint8_t bits);
+};
+
+/**
+ * Streaming decoder for blocks written by HistoryEncoder
+ * Points come out one at a time, so a range is never expanded in memory
+ */
+class HistoryDecoder {
+public:
+  HistoryDecoder(const uint8_t* buffer, size_t size, uint16_t count, uint8_t channels, uint32_t baseTime);
+
+  /**
+   * Decode the next point
+   * @return false at the end of the block or on malformed data
+   */
+  bool next(uint32_t& time, uint16_t* values);
+
+private:
+  const uint8_t* _buffer;
+  size_t _size;
+  uint8_t _channels;
+  uint32_t _bit;
+  uint16_t _remaining;
+  uint32_t _prevTime;
+  int32_t _prevDelta;
+  uint16_t _prev[HISTORY_CODEC_MAX_CHANNELS];
+
+  bool get(uint8_t bits, uint32_t& value);
+};
+
+#endif // HISTORY_CODEC_H
\ No newline at end of file
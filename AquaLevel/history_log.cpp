@@ -0,0 +1,378 @@
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <esp_rom_crc.h>
+#include "config.h"
+#include "history_log.h"
+#include "history_codec.h"
+
+#define HISTORY_LOG_DIR "/history"
+#define HISTORY_LOG_MAGIC 0x4C48            // "HL"
+#define HISTORY_LOG_VERSION 3             // 1: plain buckets, 2: encoded buckets, 3: CRC covers the headers
+#define HISTORY_LOG_BATCH 16                // Buckets per record (80 minutes of data)
+#define HISTORY_LOG_FLUSH_INTERVAL 1800     // Seconds a bucket may wait in RAM before it is written
+#define HISTORY_LOG_SEGMENT_SIZE 16384      // Bytes per segment file (about 10 days, encoded)
+#define HISTORY_LOG_MAX_SEGMENTS 36         // About a year, enough to rebuild the hour tier
+#define HISTORY_LOG_PENDING_MAGIC 0x484C5051
+
+// Wear budget
+#define FLASH_BLOCK_SIZE 4096
+#define FLASH_ERASE_CYCLES 100000           // Rated erase cycles per block
+#define HISTORY_LOG_LIFETIME_YEARS 10
+#define HISTORY_LOG_WEAR_SHARE 4            // The log may use 1/4 of the partition's erase cycles
+#define HISTORY_LOG_ERASES_PER_FLUSH 3      // Copied tail block plus metadata commits and compaction
+
+// Encoded channels: average, spreads to the minimum and maximum, sample count
+#define LOG_CHANNELS 4
+#define LOG_MAX_POINT_BYTES 14              // Worst case of one encoded point
+#define LOG_TYPICAL_POINT_BYTES 4           // Typical encoded bucket of a calm tank
+
+// Written in front of every batch of buckets
+struct __attribute__((packed)) LogRecordHeader {
+  uint16_t magic;
+  uint8_t version;
+  uint8_t count;
+  uint32_t crc;    // CRC32 of both headers (crc zeroed) and the data; versions 1 and 2: of the data only
+};
+
+// Follows the record header from version 2 on
+struct __attribute__((packed)) LogBlockHeader {
+  uint32_t time;   // Base time of the encoded block
+  uint16_t length; // Encoded bytes
+};
+
+// Buckets waiting to be written; RTC memory keeps them across deep sleep
+struct PendingLog {
+  uint32_t magic;
+  uint32_t since;  // Time of the oldest queued bucket
+  uint8_t count;
+  HistoryBucket buckets[HISTORY_LOG_BATCH];
+  HistoryBucket last;  // Newest bucket queued, kept after the batch is written (count 0: none)
+};
+
+RTC_DATA_ATTR static PendingLog pending;
+
+static bool logReady = false;
+static uint32_t firstSegment = 0;
+static uint32_t lastSegment = 0;   // Segment being appended to
+static uint32_t maxSegments = HISTORY_LOG_MAX_SEGMENTS;
+static uint32_t flushInterval = HISTORY_LOG_FLUSH_INTERVAL;
+
+// CRC32 of a record, so a damaged time, length or count is caught too
+static uint32_t recordCrc(LogRecordHeader header, const LogBlockHeader& block, const uint8_t* data, size_t length) {
+  header.crc = 0;
+  uint32_t crc = esp_rom_crc32_le(0, (const uint8_t*)&header, sizeof(header));
+  crc = esp_rom_crc32_le(crc, (const uint8_t*)&block, sizeof(block));
+  return esp_rom_crc32_le(crc, data, length);
+}
+
+static void segmentPath(uint32_t segment, char* path, size_t size) {
+  snprintf(path, size, HISTORY_LOG_DIR "/%08lu.log", (unsigned long)segment);
+}
+
+// Start a new segment, dropping the oldest ones beyond the limit
+static void rotateSegment() {
+  char path[32];
+
+  lastSegment++;
+  while (lastSegment - firstSegment + 1 > maxSegments) {
+    segmentPath(firstSegment, path, sizeof(path));
+    LittleFS.remove(path);
+    firstSegment++;
+  }
+}
+
+// Find the oldest and newest segment numbers
+static void scanSegments() {
+  bool found = false;
+  File dir = LittleFS.open(HISTORY_LOG_DIR);
+  File entry;
+
+  while ((entry = dir.openNextFile())) {
+    // Older cores report the full path
+    const char* name = strrchr(entry.name(), '/');
+    name = name ? name + 1 : entry.name();
+
+    char* end;
+    uint32_t segment = strtoul(name, &end, 10);
+    if (end != name && strcmp(end, ".log") == 0) {
+      if (!found || segment < firstSegment) firstSegment = segment;
+      if (!found || segment > lastSegment) lastSegment = segment;
+      found = true;
+    }
+    entry.close();
+  }
+  dir.close();
+
+  // Partition shrank or segments were left over
+  while (found && lastSegment - firstSegment + 1 > maxSegments) {
+    char path[32];
+    segmentPath(firstSegment, path, sizeof(path));
+    LittleFS.remove(path);
+    firstSegment++;
+  }
+}
+
+// Stretch the flush interval until the expected block erases fit the wear budget
+static void applyWearBudget() {
+  uint32_t blocks = LittleFS.totalBytes() / FLASH_BLOCK_SIZE;
+  uint32_t budget = (uint32_t)((uint64_t)blocks * FLASH_ERASE_CYCLES /
+                               (HISTORY_LOG_LIFETIME_YEARS * 365UL) / HISTORY_LOG_WEAR_SHARE);
+
+  // A full batch is written anyway, so that bounds the interval
+  uint32_t batchTime = HISTORY_LOG_BATCH * HISTORY_MINUTE_BUCKET;
+  uint32_t interval = min(flushInterval, batchTime);
+  uint32_t erasesPerDay = 86400UL / interval * HISTORY_LOG_ERASES_PER_FLUSH;
+
+  if (budget > 0 && erasesPerDay > budget) {
+    interval = min(batchTime, (uint32_t)(86400UL * HISTORY_LOG_ERASES_PER_FLUSH / budget + 1));
+    erasesPerDay = 86400UL / interval * HISTORY_LOG_ERASES_PER_FLUSH;
+    if (erasesPerDay > budget) {
+      Serial.println("[History] Partition too small for the log wear budget");
+    }
+  }
+  flushInterval = interval;
+
+  // Flash erased per byte of bucket data written
+  uint32_t recordBytes = sizeof(LogRecordHeader) + sizeof(LogBlockHeader) +
+                         (interval / HISTORY_MINUTE_BUCKET) * LOG_TYPICAL_POINT_BYTES;
+  uint32_t amplification = HISTORY_LOG_ERASES_PER_FLUSH * FLASH_BLOCK_SIZE / recordBytes;
+
+  Serial.println("[History] Log flush every " + String(flushInterval) + " s: ~" + String(erasesPerDay) +
+                 " erases/day of " + String(budget) + " budget, write amplification ~" +
+                 String(amplification) + "x");
+}
+
+bool setupHistoryLog() {
+  // RTC memory holds garbage after power-on
+  if (pending.magic != HISTORY_LOG_PENDING_MAGIC || pending.count > HISTORY_LOG_BATCH) {
+    pending.magic = HISTORY_LOG_PENDING_MAGIC;
+    pending.count = 0;
+    pending.last.count = 0;
+  }
+
+  if (!LittleFS.begin(true)) {
+    Serial.println("[History] Flash file system unavailable, history kept in RAM only");
+    return false;
+  }
+  LittleFS.mkdir(HISTORY_LOG_DIR);
+
+  // Leave half the partition free for copy-on-write
+  maxSegments = min((uint32_t)HISTORY_LOG_MAX_SEGMENTS,
+                    (uint32_t)(LittleFS.totalBytes() / 2 / HISTORY_LOG_SEGMENT_SIZE));
+  if (maxSegments < 2) {
+    maxSegments = 2;
+  }
+
+  scanSegments();
+  applyWearBudget();
+  logReady = true;
+
+  Serial.println("[History] Log segments " + String(firstSegment) + ".." + String(lastSegment) + ", " +
+                 String(LittleFS.usedBytes()) + "/" + String(LittleFS.totalBytes()) + " bytes used");
+  return true;
+}
+
+// Read a segment up to its first damaged record
+// @return false if a damaged record was found
+static bool replaySegment(uint32_t segment, void (*callback)(const HistoryBucket& bucket), size_t& replayed) {
+  char path[32];
+  segmentPath(segment, path, sizeof(path));
+
+  File file = LittleFS.open(path, "r");
+  if (!file) {
+    return true;
+  }
+
+  LogRecordHeader header;
+  LogBlockHeader block;
+  uint8_t data[HISTORY_LOG_BATCH * LOG_MAX_POINT_BYTES];
+  size_t size = file.size();
+  bool good = true;
+
+  while (file.position() < size) {
+    if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+        header.magic != HISTORY_LOG_MAGIC || header.count == 0 || header.count > HISTORY_LOG_BATCH) {
+      good = false;
+      break;
+    }
+
+    if (header.version == 1) {
+      // Plain buckets, as written before the log was encoded
+      size_t bytes = header.count * sizeof(HistoryBucket);
+      if (file.read(data, bytes) != bytes || esp_rom_crc32_le(0, data, bytes) != header.crc) {
+        good = false;
+        break;
+      }
+      for (uint8_t i = 0; i < header.count; i++) {
+        HistoryBucket bucket;
+        memcpy(&bucket, data + i * sizeof(HistoryBucket), sizeof(bucket));
+        callback(bucket);
+      }
+    } else if (header.version == 2 || header.version == HISTORY_LOG_VERSION) {
+      if (file.read((uint8_t*)&block, sizeof(block)) != sizeof(block) || block.length > sizeof(data) ||
+          file.read(data, block.length) != block.length) {
+        good = false;
+        break;
+      }
+      uint32_t crc = (header.version == 2) ? esp_rom_crc32_le(0, data, block.length)
+                                           : recordCrc(header, block, data, block.length);
+      if (crc != header.crc) {
+        good = false;
+        break;
+      }
+
+      HistoryDecoder decoder(data, block.length, header.count, LOG_CHANNELS, block.time);
+      HistoryBucket bucket;
+      uint16_t values[LOG_CHANNELS];
+      for (uint8_t i = 0; i < header.count; i++) {
+        if (!decoder.next(bucket.time, values)) {
+          good = false;
+          break;
+        }
+        bucket.avg = values[0];
+        bucket.min = values[0] - values[1];
+        bucket.max = values[0] + values[2];
+        bucket.count = values[3];
+        callback(bucket);
+      }
+      if (!good) {
+        break;
+      }
+    } else {
+      good = false;
+      break;
+    }
+    replayed += header.count;
+  }
+
+  file.close();
+  return good;
+}
+
+size_t replayHistoryLog(void (*callback)(const HistoryBucket& bucket)) {
+  size_t replayed = 0;
+
+  if (logReady) {
+    unsigned long start = millis();
+
+    for (uint32_t segment = firstSegment; segment <= lastSegment; segment++) {
+      if (!replaySegment(segment, callback, replayed)) {
+        Serial.println("[History] Damaged record in segment " + String(segment) + ", rest of the segment skipped");
+
+        // Never append behind a damaged record
+        if (segment == lastSegment) {
+          rotateSegment();
+          break;
+        }
+      }
+    }
+
+    Serial.println("[History] Replayed " + String(replayed) + " buckets from " +
+                   String(lastSegment - firstSegment + 1) + " segments in " + String(millis() - start) + " ms");
+  }
+
+  for (uint8_t i = 0; i < pending.count; i++) {
+    callback(pending.buckets[i]);
+  }
+
+  return replayed + pending.count;
+}
+
+size_t replayPendingHistoryLog(void (*callback)(const HistoryBucket& bucket)) {
+  for (uint8_t i = 0; i < pending.count; i++) {
+    callback(pending.buckets[i]);
+  }
+
+  // Once the batch is written the bucket being filled is only on flash
+  if (pending.count == 0 && pending.last.count > 0) {
+    callback(pending.last);
+    return 1;
+  }
+  return pending.count;
+}
+
+// Write the queued buckets as one record
+static void writePending() {
+  if (pending.count == 0) {
+    return;
+  }
+
+  if (logReady) {
+    // Buckets are consecutive, so times and values encode to a few bits each
+    uint8_t data[HISTORY_LOG_BATCH * LOG_MAX_POINT_BYTES];
+    HistoryEncoder encoder;
+    encoder.begin(data, sizeof(data), LOG_CHANNELS, pending.buckets[0].time);
+    for (uint8_t i = 0; i < pending.count; i++) {
+      const HistoryBucket& bucket = pending.buckets[i];
+      uint16_t values[LOG_CHANNELS] = {
+        bucket.avg, (uint16_t)(bucket.avg - bucket.min), (uint16_t)(bucket.max - bucket.avg), bucket.count
+      };
+      encoder.add(bucket.time, values);
+    }
+
+    LogRecordHeader header;
+    LogBlockHeader block;
+    size_t bytes = encoder.length();
+    header.magic = HISTORY_LOG_MAGIC;
+    header.version = HISTORY_LOG_VERSION;
+    header.count = pending.count;
+    block.time = pending.buckets[0].time;
+    block.length = bytes;
+    header.crc = recordCrc(header, block, data, bytes);
+
+    char path[32];
+    segmentPath(lastSegment, path, sizeof(path));
+    File file = LittleFS.open(path, "a");
+    if (file && file.size() + sizeof(header) + sizeof(block) + bytes > HISTORY_LOG_SEGMENT_SIZE) {
+      file.close();
+      rotateSegment();
+      segmentPath(lastSegment, path, sizeof(path));
+      file = LittleFS.open(path, "a");
+    }
+
+    // LittleFS commits on close, so a power loss leaves the file as it was
+    bool written = file &&
+                   file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+                   file.write((const uint8_t*)&block, sizeof(block)) == sizeof(block) &&
+                   file.write(data, bytes) == bytes;
+    if (file) {
+      file.close();
+    }
+
+    if (!written) {
+      Serial.println("[History] Log write failed, " + String(pending.count) + " buckets lost");
+    }
+  }
+
+  pending.count = 0;
+}
+
+void appendHistoryLog(const HistoryBucket& bucket) {
+  if (pending.count > 0) {
+    HistoryBucket& last = pending.buckets[pending.count - 1];
+    if (bucket.time < last.time) {
+      return;
+    }
+    if (bucket.time == last.time) {
+      last = bucket;
+      pending.last = bucket;
+      return;
+    }
+  }
+
+  if (pending.count == 0) {
+    pending.since = bucket.time;
+  }
+  pending.buckets[pending.count++] = bucket;
+  pending.last = bucket;
+
+  if (pending.count == HISTORY_LOG_BATCH) {
+    writePending();
+  }
+}
+
+void processHistoryLog(uint32_t now, bool force) {
+  if (pending.count > 0 && (force || now - pending.since >= flushInterval)) {
+    writePending();
+  }
+}
\ No newline at end of file
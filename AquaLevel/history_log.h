@@ -0,0 +1,44 @@
+// history_log.h
+#ifndef HISTORY_LOG_H
+#define HISTORY_LOG_H
+
+#include <Arduino.h>
+#include "history_store.h"
+
+/**
+ * Mount the flash file system, find the log segments and size the flush
+ * interval to the partition's wear budget
+ * @return true if the log is usable
+ */
+bool setupHistoryLog();
+
+/**
+ * Feed every good bucket of the log to the callback, oldest first, followed
+ * by buckets still waiting to be written
+ * Reading a segment stops at its first damaged record
+ * @return Number of buckets replayed
+ */
+size_t replayHistoryLog(void (*callback)(const HistoryBucket& bucket));
+
+/**
+ * Feed only the buckets kept in RTC memory, without reading flash: those
+ * still waiting to be written, or else the newest one written
+ * Enough to carry on filling the open bucket after a wake from deep sleep
+ * @return Number of buckets replayed
+ */
+size_t replayPendingHistoryLog(void (*callback)(const HistoryBucket& bucket));
+
+/**
+ * Queue a 5 minute bucket for writing; a full batch is written right away
+ * A bucket with the time of the last queued one replaces it
+ */
+void appendHistoryLog(const HistoryBucket& bucket);
+
+/**
+ * Write queued buckets once the oldest has waited for the flush interval
+ * @param now Current wall-clock time (seconds)
+ * @param force Write whatever is queued now
+ */
+void processHistoryLog(uint32_t now, bool force);
+
+#endif // HISTORY_LOG_H
\ No newline at end of file
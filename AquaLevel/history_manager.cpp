@@ -0,0 +1,161 @@
+#include <Arduino.h>
+#include <time.h>
+#include <esp_sleep.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "config.h"
+#include "history_manager.h"
+#include "history_log.h"
+#include "tank_calculator.h"
+#include "wifi_manager.h"
+
+#define HISTORY_MIN_VALID_TIME 1600000000UL  // Anything earlier means the clock was never set
+#define NTP_SERVER_1 "pool.ntp.org"
+#define NTP_SERVER_2 "time.google.com"
+
+// Large, so kept out of the stack and the heap
+static HistoryStore history;
+static SemaphoreHandle_t historyMutex = NULL;
+static bool ntpStarted = false;
+static bool clockValid = false;
+static volatile bool logDeferred = false;       // Replay skipped on a deep-sleep wake
+static volatile bool logLoadRequested = false;  // Set by /history, handled by processHistory()
+
+static void replayBucket(const HistoryBucket& bucket) {
+  history.addBucket(bucket);
+}
+
+// Rebuild the 5 minute and hour tiers from the flash log
+// Logged buckets carry wall-clock times, so this waits for a valid clock
+// The bucket being filled is kept: it may hold samples the log does not
+// have yet. Raw samples taken before the replay are dropped
+static void loadHistoryLog() {
+  xSemaphoreTake(historyMutex, portMAX_DELAY);
+  HistoryBucket open;
+  bool hasOpen = history.openBucket(open);
+  history.clear();
+  replayHistoryLog(replayBucket);
+  if (hasOpen) {
+    history.addBucket(open);
+  }
+  xSemaphoreGive(historyMutex);
+  
+  logDeferred = false;
+}
+
+void setupHistory() {
+  historyMutex = xSemaphoreCreateMutex();
+  
+  // The RTC keeps time across deep sleep
+  clockValid = time(NULL) >= (time_t)HISTORY_MIN_VALID_TIME;
+  
+  Serial.println("History store: " + String(sizeof(history)) + " bytes, clock " +
+                 (clockValid ? "set" : "not set"));
+  
+  if (setupHistoryLog() && clockValid) {
+    if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER) {
+      // Reading the whole log would add to every wake; only carry on the
+      // bucket being filled and leave the rest until /history asks for it
+      xSemaphoreTake(historyMutex, portMAX_DELAY);
+      replayPendingHistoryLog(replayBucket);
+      xSemaphoreGive(historyMutex);
+      logDeferred = true;
+    } else {
+      loadHistoryLog();
+    }
+  }
+}
+
+void processHistory() {
+  if (!ntpStarted && wifiManager.isConnected()) {
+    configTime(0, 0, NTP_SERVER_1, NTP_SERVER_2);
+    ntpStarted = true;
+  }
+  
+  if (!clockValid && time(NULL) >= (time_t)HISTORY_MIN_VALID_TIME) {
+    // Samples so far were stamped with uptime and cannot be placed behind
+    // the logged ones, so the tiers start over from the log
+    xSemaphoreTake(historyMutex, portMAX_DELAY);
+    history.clear();
+    clockValid = true;
+    xSemaphoreGive(historyMutex);
+    
+    Serial.println("[History] Clock set, timestamps now wall-clock");
+    loadHistoryLog();
+  }
+  
+  if (logLoadRequested) {
+    logLoadRequested = false;
+    if (logDeferred) {
+      loadHistoryLog();
+    }
+  }
+  
+  if (clockValid) {
+    processHistoryLog(getHistoryTime(), false);
+  }
+}
+
+bool requestHistoryLog() {
+  if (!logDeferred) {
+    return true;
+  }
+  logLoadRequested = true;
+  return false;
+}
+
+uint32_t getHistoryTime() {
+  if (clockValid) {
+    return (uint32_t)time(NULL);
+  }
+  return millis() / 1000;
+}
+
+bool isHistoryClockValid() {
+  return clockValid;
+}
+
+void recordHistory() {
+  uint32_t now = getHistoryTime();
+  
+  xSemaphoreTake(historyMutex, portMAX_DELAY);
+  bool closed = history.add(now, currentPercentage);
+  HistoryBucket bucket = history.lastBucket();
+  xSemaphoreGive(historyMutex);
+  
+  // Only wall-clock buckets mean anything after a reboot
+  if (closed && clockValid) {
+    appendHistoryLog(bucket);
+  }
+}
+
+void saveHistory(bool toFlash) {
+  if (!clockValid) {
+    return;
+  }
+  
+  // Keep the partly filled bucket too; the next boot carries on filling it
+  HistoryBucket bucket;
+  xSemaphoreTake(historyMutex, portMAX_DELAY);
+  bool open = history.openBucket(bucket);
+  xSemaphoreGive(historyMutex);
+  
+  if (open) {
+    appendHistoryLog(bucket);
+  }
+  processHistoryLog(getHistoryTime(), toFlash);
+}
+
+uint8_t selectHistoryTier(uint32_t from) {
+  xSemaphoreTake(historyMutex, portMAX_DELAY);
+  uint8_t tier = history.selectTier(from);
+  xSemaphoreGive(historyMutex);
+  return tier;
+}
+
+size_t readHistory(uint8_t tier, uint32_t from, uint32_t to, HistoryPoint* points, size_t maxPoints) {
+  xSemaphoreTake(historyMutex, portMAX_DELAY);
+  size_t count = history.read(tier, from, to, points, maxPoints);
+  xSemaphoreGive(historyMutex);
+  return count;
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+// history_manager.h
+#ifndef HISTORY_MANAGER_H
+#define HISTORY_MANAGER_H
+
+#include "history_store.h"
+
+/**
+ * Initialize the level history and replay the flash log
+ * A wake from deep sleep defers the replay, see requestHistoryLog()
+ */
+void setupHistory();
+
+/**
+ * Start NTP once the station is connected; once the clock is set, the
+ * samples stamped with uptime are dropped and the flash log is replayed
+ * Should be called regularly in the main loop
+ */
+void processHistory();
+
+/**
+ * Record the current water level percentage
+ * Call after each new water level calculation
+ */
+void recordHistory();
+
+/**
+ * Queue the bucket being filled for the flash log before a restart or deep sleep
+ * @param toFlash Write queued buckets now; otherwise RTC memory keeps them
+ *                until the flush interval is up
+ */
+void saveHistory(bool toFlash);
+
+/**
+ * Current history timestamp
+ * @return Unix seconds once the clock is set, otherwise seconds since boot
+ */
+uint32_t getHistoryTime();
+
+/**
+ * Check if history timestamps are wall-clock (Unix) seconds
+ */
+bool isHistoryClockValid();
+
+/**
+ * Check that the flash log has been replayed, else ask the main loop to
+ * replay it; safe to call from web server handlers
+ * @return false while older history is still missing
+ */
+bool requestHistoryLog();
+
+/**
+ * Finest history tier that still holds data from the given time
+ */
+uint8_t selectHistoryTier(uint32_t from);
+
+/**
+ * Copy up to maxPoints history points with from <= time <= to, oldest first
+ * Safe to call from web server handlers while the loop records samples
+ * @return Number of points copied
+ */
+size_t readHistory(uint8_t tier, uint32_t from, uint32_t to, HistoryPoint* points, size_t maxPoints);
+
+#endif // HISTORY_MANAGER_H
\ No newline at end of file
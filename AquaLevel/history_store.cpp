@@ -0,0 +1,268 @@
+#include "history_store.h"
+
+// Stored value scale: percentage in 0.01 % steps
+#define HISTORY_VALUE_SCALE 100.0f
+#define HISTORY_VALUE_MAX 10000
+
+// Encoded channels: raw samples carry the value; buckets carry the average
+// and the spreads down to the minimum and up to the maximum, which stay
+// small and steady while the level is calm
+#define RAW_CHANNELS 1
+#define BUCKET_CHANNELS 3
+
+static uint16_t quantize(float value) {
+  if (!(value > 0)) return 0;  // Also catches NaN
+  if (value >= 100.0f) return HISTORY_VALUE_MAX;
+  return (uint16_t)(value * HISTORY_VALUE_SCALE + 0.5f);
+}
+
+static float dequantize(uint32_t value) {
+  return value / HISTORY_VALUE_SCALE;
+}
+
+HistoryStore::HistoryStore() {
+  _tiers[HISTORY_TIER_RAW].blocks = _rawBlocks;
+  _tiers[HISTORY_TIER_RAW].capacity = HISTORY_RAW_BLOCKS;
+  _tiers[HISTORY_TIER_RAW].channels = RAW_CHANNELS;
+  _tiers[HISTORY_TIER_MINUTE].blocks = _minuteBlocks;
+  _tiers[HISTORY_TIER_MINUTE].capacity = HISTORY_MINUTE_BLOCKS;
+  _tiers[HISTORY_TIER_MINUTE].channels = BUCKET_CHANNELS;
+  _tiers[HISTORY_TIER_HOUR].blocks = _hourBlocks;
+  _tiers[HISTORY_TIER_HOUR].capacity = HISTORY_HOUR_BLOCKS;
+  _tiers[HISTORY_TIER_HOUR].channels = BUCKET_CHANNELS;
+  clear();
+}
+
+void HistoryStore::clear() {
+  for (uint8_t tier = 0; tier < HISTORY_TIER_COUNT; tier++) {
+    _tiers[tier].head = 0;
+    _tiers[tier].used = 0;
+    _tiers[tier].points = 0;
+    _tiers[tier].last = 0;
+  }
+  _minuteAcc.count = 0;
+  _hourAcc.count = 0;
+  _lastBucket.count = 0;
+  _bucketClosed = false;
+}
+
+uint32_t HistoryStore::resolution(uint8_t tier) {
+  switch (tier) {
+    case HISTORY_TIER_RAW:    return 0;
+    case HISTORY_TIER_MINUTE: return HISTORY_MINUTE_BUCKET;
+    default:                  return HISTORY_HOUR_BUCKET;
+  }
+}
+
+size_t HistoryStore::count(uint8_t tier) const {
+  return tier < HISTORY_TIER_COUNT ? _tiers[tier].points : 0;
+}
+
+size_t HistoryStore::encodedBytes(uint8_t tier) const {
+  if (tier >= HISTORY_TIER_COUNT) {
+    return 0;
+  }
+
+  size_t bytes = 0;
+  for (size_t i = 0; i < _tiers[tier].used; i++) {
+    bytes += blockAt(tier, i).length;
+  }
+  return bytes;
+}
+
+// The index-th oldest block of a tier
+const HistoryStore::Block& HistoryStore::blockAt(uint8_t tier, size_t index) const {
+  const Tier& t = _tiers[tier];
+  return t.blocks[(t.head + t.capacity - t.used + index) % t.capacity];
+}
+
+void HistoryStore::append(uint8_t tier, uint32_t time, const uint16_t* values) {
+  Tier& t = _tiers[tier];
+
+  if (t.used == 0 || !t.encoder.add(time, values)) {
+    // Start a new block, dropping the oldest once the ring is full
+    Block& block = t.blocks[t.head];
+    if (t.used == t.capacity) {
+      t.points -= block.count;
+    } else {
+      t.used++;
+    }
+    t.head = (t.head + 1) % t.capacity;
+
+    block.time = time;
+    t.encoder.begin(block.data, sizeof(block.data), t.channels, time);
+    t.encoder.add(time, values);  // Always fits an empty block
+  }
+
+  Block& newest = t.blocks[(t.head + t.capacity - 1) % t.capacity];
+  newest.count = t.encoder.count();
+  newest.length = t.encoder.length();
+  t.points++;
+  t.last = time;
+}
+
+void HistoryStore::toBucket(const Accumulator& acc, HistoryBucket& bucket) {
+  bucket.time = acc.time;
+  bucket.min = acc.min;
+  bucket.avg = (uint16_t)((acc.sum + acc.count / 2) / acc.count);
+  bucket.max = acc.max;
+  bucket.count = acc.count > 0xFFFF ? 0xFFFF : (uint16_t)acc.count;
+}
+
+void HistoryStore::pushBucket(uint8_t tier, const Accumulator& acc) {
+  HistoryBucket bucket;
+  toBucket(acc, bucket);
+
+  uint16_t values[BUCKET_CHANNELS] = {
+    bucket.avg, (uint16_t)(bucket.avg - bucket.min), (uint16_t)(bucket.max - bucket.avg)
+  };
+  append(tier, bucket.time, values);
+}
+
+// Merge samples into a tier's open bucket, closing it when a new bucket starts
+void HistoryStore::accumulate(Accumulator& acc, uint32_t bucketTime, uint16_t min, uint16_t max,
+                              uint32_t sum, uint32_t count, uint8_t tier) {
+  if (acc.count > 0 && acc.time != bucketTime) {
+    pushBucket(tier, acc);
+
+    // Closed minute buckets roll up into the hour tier
+    if (tier == HISTORY_TIER_MINUTE) {
+      toBucket(acc, _lastBucket);
+      _bucketClosed = true;
+      accumulate(_hourAcc, acc.time - acc.time % HISTORY_HOUR_BUCKET, acc.min, acc.max,
+                 acc.sum, acc.count, HISTORY_TIER_HOUR);
+    }
+    acc.count = 0;
+  }
+
+  if (acc.count == 0) {
+    acc.time = bucketTime;
+    acc.min = min;
+    acc.max = max;
+    acc.sum = 0;
+  } else {
+    if (min < acc.min) acc.min = min;
+    if (max > acc.max) acc.max = max;
+  }
+  acc.sum += sum;
+  acc.count += count;
+}
+
+bool HistoryStore::add(uint32_t time, float value) {
+  uint16_t quantized = quantize(value);
+  _bucketClosed = false;
+
+  append(HISTORY_TIER_RAW, time, &quantized);
+
+  accumulate(_minuteAcc, time - time % HISTORY_MINUTE_BUCKET, quantized, quantized,
+             quantized, 1, HISTORY_TIER_MINUTE);
+  return _bucketClosed;
+}
+
+bool HistoryStore::openBucket(HistoryBucket& bucket) const {
+  if (_minuteAcc.count == 0) {
+    return false;
+  }
+  toBucket(_minuteAcc, bucket);
+  return true;
+}
+
+void HistoryStore::addBucket(const HistoryBucket& bucket) {
+  if (bucket.count == 0) {
+    return;
+  }
+
+  if (_minuteAcc.count > 0) {
+    if (bucket.time < _minuteAcc.time) {
+      return;
+    }
+    if (bucket.time == _minuteAcc.time) {
+      _minuteAcc.count = 0;
+    }
+  } else if (_tiers[HISTORY_TIER_MINUTE].points > 0 && bucket.time <= _tiers[HISTORY_TIER_MINUTE].last) {
+    return;
+  }
+
+  accumulate(_minuteAcc, bucket.time, bucket.min, bucket.max,
+             (uint32_t)bucket.avg * bucket.count, bucket.count, HISTORY_TIER_MINUTE);
+}
+
+uint8_t HistoryStore::selectTier(uint32_t from) const {
+  for (uint8_t tier = 0; tier < HISTORY_TIER_COUNT; tier++) {
+    if (_tiers[tier].used > 0 && blockAt(tier, 0).time <= from) {
+      return tier;
+    }
+  }
+
+  // Nothing reaches back that far: use the tier with the longest span
+  for (uint8_t tier = HISTORY_TIER_COUNT; tier > 0; tier--) {
+    if (_tiers[tier - 1].used > 0) {
+      return tier - 1;
+    }
+  }
+  return HISTORY_TIER_RAW;
+}
+
+size_t HistoryStore::read(uint8_t tier, uint32_t from, uint32_t to, HistoryPoint* points, size_t maxPoints) const {
+  if (tier >= HISTORY_TIER_COUNT || from > to) {
+    return 0;
+  }
+
+  const Tier& t = _tiers[tier];
+
+  // Last block starting at or before 'from' (blocks are in time order)
+  size_t low = 0;
+  size_t high = t.used;
+  while (low < high) {
+    size_t mid = (low + high) / 2;
+    if (blockAt(tier, mid).time <= from) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  size_t copied = 0;
+  bool past = false;
+  for (size_t i = low > 0 ? low - 1 : 0; i < t.used && copied < maxPoints && !past; i++) {
+    const Block& block = blockAt(tier, i);
+    HistoryDecoder decoder(block.data, block.length, block.count, t.channels, block.time);
+    uint32_t time;
+    uint16_t values[BUCKET_CHANNELS];
+
+    while (copied < maxPoints && decoder.next(time, values)) {
+      if (time < from) {
+        continue;
+      }
+      if (time > to) {
+        past = true;
+        break;
+      }
+
+      HistoryPoint& point = points[copied++];
+      point.time = time;
+      if (tier == HISTORY_TIER_RAW) {
+        point.min = point.avg = point.max = dequantize(values[0]);
+      } else {
+        point.avg = dequantize(values[0]);
+        point.min = dequantize(values[0] - values[1]);
+        point.max = dequantize(values[0] + values[2]);
+      }
+    }
+  }
+
+  // The bucket still being filled is the newest point of a coarse tier
+  if (tier != HISTORY_TIER_RAW && copied < maxPoints && !past) {
+    const Accumulator& acc = (tier == HISTORY_TIER_MINUTE) ? _minuteAcc : _hourAcc;
+    bool newer = t.points == 0 || acc.time > t.last;
+    if (acc.count > 0 && newer && acc.time >= from && acc.time <= to) {
+      HistoryPoint& point = points[copied++];
+      point.time = acc.time;
+      point.min = dequantize(acc.min);
+      point.avg = dequantize((acc.sum + acc.count / 2) / acc.count);
+      point.max = dequantize(acc.max);
+    }
+  }
+
+  return copied;
+}
\ No newline at end of file
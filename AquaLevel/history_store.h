@@ -0,0 +1,173 @@
+// history_store.h
+#ifndef HISTORY_STORE_H
+#define HISTORY_STORE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "history_codec.h"
+
+// Tiers, finest first
+#define HISTORY_TIER_RAW    0
+#define HISTORY_TIER_MINUTE 1
+#define HISTORY_TIER_HOUR   2
+#define HISTORY_TIER_COUNT  3
+
+// Points are stored compressed in fixed-size blocks; the oldest block of a
+// tier is dropped when it is full
+#define HISTORY_BLOCK_SIZE 64          // Bytes per block, header included
+
+// Default capacities in blocks, sized for a slowly changing level:
+// a few hours of raw samples at 5 s, about two weeks of 5 min buckets and half a
+// year of 1 h buckets (tools/bench/history_bench.cpp measures them on a trace)
+#ifndef HISTORY_RAW_BLOCKS
+#define HISTORY_RAW_BLOCKS 64
+#endif
+#ifndef HISTORY_MINUTE_BLOCKS
+#define HISTORY_MINUTE_BLOCKS 256
+#endif
+#ifndef HISTORY_HOUR_BLOCKS
+#define HISTORY_HOUR_BLOCKS 448
+#endif
+
+#define HISTORY_MINUTE_BUCKET 300      // Seconds per bucket
+#define HISTORY_HOUR_BUCKET 3600
+
+/**
+ * One history point as returned by queries
+ * Raw samples have min == avg == max
+ */
+struct HistoryPoint {
+  uint32_t time;   // Start of the sample or bucket (seconds)
+  float min;
+  float avg;
+  float max;
+};
+
+/**
+ * A 5 minute bucket in stored form, as kept in the flash log
+ * Values are percentages in 0.01 % steps
+ */
+struct HistoryBucket {
+  uint32_t time;   // Start of the bucket (seconds)
+  uint16_t min;
+  uint16_t avg;
+  uint16_t max;
+  uint16_t count;  // Samples merged into the bucket
+};
+
+/**
+ * Fixed-size, allocation-free store of timestamped level samples
+ * Recent samples are kept at full resolution and older data as
+ * min/avg/max buckets of two coarser tiers, each in its own ring of
+ * compressed blocks (see HistoryEncoder)
+ * Values are percentages, stored in 0.01 % steps
+ * Has no Arduino dependencies, so it can be exercised on the host
+ */
+class HistoryStore {
+public:
+  HistoryStore();
+
+  /**
+   * Drop all samples
+   */
+  void clear();
+
+  /**
+   * Record a sample; times must not go backwards
+   * @return true if a 5 minute bucket was closed (see lastBucket())
+   */
+  bool add(uint32_t time, float value);
+
+  /**
+   * Most recently closed 5 minute bucket
+   */
+  const HistoryBucket& lastBucket() const { return _lastBucket; }
+
+  /**
+   * Get the 5 minute bucket still being filled
+   * @return false if there is none
+   */
+  bool openBucket(HistoryBucket& bucket) const;
+
+  /**
+   * Restore a 5 minute bucket, e.g. replayed from flash
+   * A bucket with the time of the open bucket replaces it (it is a newer
+   * copy of the same bucket); older buckets are ignored
+   */
+  void addBucket(const HistoryBucket& bucket);
+
+  /**
+   * Seconds covered by one point of a tier (0 for raw samples)
+   */
+  static uint32_t resolution(uint8_t tier);
+
+  /**
+   * Finest tier that still holds data from the given time
+   */
+  uint8_t selectTier(uint32_t from) const;
+
+  /**
+   * Copy up to maxPoints points of a tier with from <= time <= to, oldest first
+   * Only the block holding 'from' onwards is decoded
+   * Call again with from = last time + 1 to continue a range
+   * @return Number of points copied
+   */
+  size_t read(uint8_t tier, uint32_t from, uint32_t to, HistoryPoint* points, size_t maxPoints) const;
+
+  /**
+   * Number of points held by a tier
+   */
+  size_t count(uint8_t tier) const;
+
+  /**
+   * Bytes of encoded data held by a tier
+   */
+  size_t encodedBytes(uint8_t tier) const;
+
+private:
+  struct Block {
+    uint32_t time;    // Time of the first point
+    uint16_t count;   // Points in the block
+    uint16_t length;  // Encoded bytes
+    uint8_t data[HISTORY_BLOCK_SIZE - 8];
+  };
+
+  // A ring of blocks; the newest one is being appended to
+  struct Tier {
+    Block* blocks;
+    size_t capacity;
+    size_t head;      // Next block to start
+    size_t used;      // Blocks holding data
+    size_t points;
+    uint32_t last;    // Time of the newest point
+    uint8_t channels;
+    HistoryEncoder encoder;
+  };
+
+  // Bucket being filled for a coarser tier
+  struct Accumulator {
+    uint32_t time;
+    uint16_t min;
+    uint16_t max;
+    uint32_t sum;
+    uint32_t count;
+  };
+
+  Block _rawBlocks[HISTORY_RAW_BLOCKS];
+  Block _minuteBlocks[HISTORY_MINUTE_BLOCKS];
+  Block _hourBlocks[HISTORY_HOUR_BLOCKS];
+  Tier _tiers[HISTORY_TIER_COUNT];
+  Accumulator _minuteAcc;
+  Accumulator _hourAcc;
+  HistoryBucket _lastBucket;
+  bool _bucketClosed;
+
+  const Block& blockAt(uint8_t tier, size_t index) const;
+  void append(uint8_t tier, uint32_t time, const uint16_t* values);
+  static void toBucket(const Accumulator& acc, HistoryBucket& bucket);
+  void pushBucket(uint8_t tier, const Accumulator& acc);
+  void accumulate(Accumulator& acc, uint32_t bucketTime, uint16_t min, uint16_t max,
+                  uint32_t sum, uint32_t count, uint8_t tier);
+};
+
+#endif // HISTORY_STORE_H
\ No newline at end of file
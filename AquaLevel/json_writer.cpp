@@ -0,0 +1,182 @@
+#include <math.h>
+#include "json_writer.h"
+
+// Powers of ten for rounding to a number of decimals
+static const uint32_t POW10[] = {1, 10, 100, 1000, 10000, 100000};
+#define JSON_MAX_DECIMALS 5
+
+JsonWriter::JsonWriter(char* buffer, size_t size)
+  : _buffer(buffer), _size(size), _length(0), _overflow(false), _depth(0) {
+  _first[0] = true;
+  if (_size > 0) {
+    _buffer[0] = '\0';
+  }
+}
+
+void JsonWriter::put(char c) {
+  // Keep room for the terminator
+  if (_length + 1 >= _size) {
+    _overflow = true;
+    return;
+  }
+  _buffer[_length++] = c;
+  _buffer[_length] = '\0';
+}
+
+void JsonWriter::put(const char* text) {
+  while (*text) {
+    put(*text++);
+  }
+}
+
+void JsonWriter::putEscaped(const char* text) {
+  static const char HEX_DIGITS[] = "0123456789abcdef";
+
+  put('"');
+  for (; *text; text++) {
+    char c = *text;
+    switch (c) {
+      case '"':  put("\\\""); break;
+      case '\\': put("\\\\"); break;
+      case '\n': put("\\n"); break;
+      case '\r': put("\\r"); break;
+      case '\t': put("\\t"); break;
+      default:
+        if ((uint8_t)c < 0x20) {
+          put("\\u00");
+          put(HEX_DIGITS[(c >> 4) & 0x0F]);
+          put(HEX_DIGITS[c & 0x0F]);
+        } else {
+          put(c);
+        }
+        break;
+    }
+  }
+  put('"');
+}
+
+void JsonWriter::putUnsigned(unsigned long value) {
+  char digits[20];
+  int count = 0;
+  do {
+    digits[count++] = '0' + (value % 10);
+    value /= 10;
+  } while (value > 0);
+
+  while (count > 0) {
+    put(digits[--count]);
+  }
+}
+
+void JsonWriter::beginValue(const char* key) {
+  if (!_first[_depth]) {
+    put(',');
+  }
+  _first[_depth] = false;
+
+  if (key) {
+    putEscaped(key);
+    put(':');
+  }
+}
+
+void JsonWriter::beginObject(const char* key) {
+  if (_depth > 0 || key) {
+    beginValue(key);
+  }
+  put('{');
+  if (_depth + 1 < JSON_MAX_DEPTH) {
+    _first[++_depth] = true;
+  } else {
+    _overflow = true;
+  }
+}
+
+void JsonWriter::endObject() {
+  put('}');
+  if (_depth > 0) {
+    _depth--;
+  }
+}
+
+void JsonWriter::beginArray(const char* key) {
+  if (_depth > 0 || key) {
+    beginValue(key);
+  }
+  put('[');
+  if (_depth + 1 < JSON_MAX_DEPTH) {
+    _first[++_depth] = true;
+  } else {
+    _overflow = true;
+  }
+}
+
+void JsonWriter::endArray() {
+  put(']');
+  if (_depth > 0) {
+    _depth--;
+  }
+}
+
+void JsonWriter::add(const char* key, const char* value) {
+  beginValue(key);
+  if (value) {
+    putEscaped(value);
+  } else {
+    put("null");
+  }
+}
+
+void JsonWriter::add(const char* key, bool value) {
+  beginValue(key);
+  put(value ? "true" : "false");
+}
+
+void JsonWriter::add(const char* key, long value) {
+  beginValue(key);
+  if (value < 0) {
+    put('-');
+    putUnsigned(0UL - (unsigned long)value);
+  } else {
+    putUnsigned((unsigned long)value);
+  }
+}
+
+void JsonWriter::add(const char* key, unsigned long value) {
+  beginValue(key);
+  putUnsigned(value);
+}
+
+void JsonWriter::add(const char* key, float value, uint8_t decimals) {
+  beginValue(key);
+
+  // JSON has no NaN or infinity; out-of-range values would not fit the fixed point either
+  if (isnan(value) || isinf(value) || fabsf(value) >= 4.0e9f) {
+    put("null");
+    return;
+  }
+
+  if (decimals > JSON_MAX_DECIMALS) {
+    decimals = JSON_MAX_DECIMALS;
+  }
+
+  // Round once in fixed point so e.g. 9.96 with one decimal prints as 10.0
+  double scaled = fabs((double)value) * POW10[decimals] + 0.5;
+  uint64_t fixed = (uint64_t)scaled;
+  uint64_t whole = fixed / POW10[decimals];
+  uint32_t fraction = (uint32_t)(fixed % POW10[decimals]);
+
+  if (value < 0 && fixed != 0) {
+    put('-');
+  }
+  putUnsigned((unsigned long)whole);
+
+  if (decimals > 0) {
+    put('.');
+    // Leading zeros of the fraction
+    for (uint32_t limit = POW10[decimals - 1]; limit > 1 && fraction < limit; limit /= 10) {
+      put('0');
+    }
+    putUnsigned(fraction);
+  }
+}
\ No newline at end of file
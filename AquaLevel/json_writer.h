@@ -0,0 +1,54 @@
+// json_writer.h
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define JSON_MAX_DEPTH 8
+
+/**
+ * Streaming JSON writer into a caller-supplied buffer
+ * Never allocates; commas, float formatting and string escaping are handled
+ * here so handlers only name their fields
+ * Output is truncated (and overflowed() set) if the buffer is too small
+ * Has no Arduino dependencies, so it can be exercised on the host
+ */
+class JsonWriter {
+public:
+  JsonWriter(char* buffer, size_t size);
+
+  void beginObject(const char* key = nullptr);
+  void endObject();
+  void beginArray(const char* key = nullptr);
+  void endArray();
+
+  // Members of an object; pass a null key for array elements
+  void add(const char* key, const char* value);
+  void add(const char* key, bool value);
+  void add(const char* key, long value);
+  void add(const char* key, unsigned long value);
+  void add(const char* key, int value) { add(key, (long)value); }
+  void add(const char* key, unsigned int value) { add(key, (unsigned long)value); }
+  void add(const char* key, float value, uint8_t decimals);
+
+  const char* c_str() const { return _buffer; }
+  size_t length() const { return _length; }
+  bool overflowed() const { return _overflow; }
+
+private:
+  char* _buffer;
+  size_t _size;
+  size_t _length;
+  bool _overflow;
+  uint8_t _depth;
+  bool _first[JSON_MAX_DEPTH];  // No member written yet at this depth
+
+  void put(char c);
+  void put(const char* text);
+  void putEscaped(const char* text);
+  void putUnsigned(unsigned long value);
+  void beginValue(const char* key);
+};
+
+#endif // JSON_WRITER_H
\ No newline at end of file
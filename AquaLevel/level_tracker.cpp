@@ -0,0 +1,65 @@
+#include <math.h>
+#include "level_tracker.h"
+
+// Initial rate uncertainty in (cm/s)^2; lets the first few samples set the rate
+#define INITIAL_RATE_VARIANCE 1.0f
+
+LevelTracker::LevelTracker(float processNoise, float measurementNoise, float resetDistance)
+  : _processNoise(processNoise), _measurementNoise(measurementNoise), _resetDistance(resetDistance) {
+  reset();
+}
+
+void LevelTracker::reset() {
+  _initialized = false;
+  _distance = 0;
+  _rate = 0;
+  _p00 = _p01 = _p11 = 0;
+}
+
+void LevelTracker::update(float distance, float dt) {
+  // Start a new track on the first sample or after a jump (e.g. sensor moved)
+  if (!_initialized || dt <= 0 || fabsf(distance - _distance) > _resetDistance) {
+    _distance = distance;
+    _rate = 0;
+    _p00 = _measurementNoise;
+    _p01 = 0;
+    _p11 = INITIAL_RATE_VARIANCE;
+    _initialized = true;
+    return;
+  }
+  
+  // Predict: x = F x, P = F P F' + Q (white acceleration noise)
+  _distance += _rate * dt;
+  float dt2 = dt * dt;
+  _p00 += dt * (2 * _p01 + dt * _p11) + _processNoise * dt2 * dt / 3;
+  _p01 += dt * _p11 + _processNoise * dt2 / 2;
+  _p11 += _processNoise * dt;
+  
+  // Update with the measured distance
+  float innovation = distance - _distance;
+  float s = _p00 + _measurementNoise;
+  float k0 = _p00 / s;
+  float k1 = _p01 / s;
+  
+  _distance += k0 * innovation;
+  _rate += k1 * innovation;
+  
+  float p00 = _p00, p01 = _p01;
+  _p00 = (1 - k0) * p00;
+  _p01 = (1 - k0) * p01;
+  _p11 -= k1 * p01;
+}
+
+LevelTracker::State LevelTracker::state() const {
+  State state = { _initialized, _distance, _rate, _p00, _p01, _p11 };
+  return state;
+}
+
+void LevelTracker::restore(const State& state) {
+  _initialized = state.initialized;
+  _distance = state.distance;
+  _rate = state.rate;
+  _p00 = state.p00;
+  _p01 = state.p01;
+  _p11 = state.p11;
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+// level_tracker.h
+#ifndef LEVEL_TRACKER_H
+#define LEVEL_TRACKER_H
+
+/**
+ * Constant-velocity Kalman filter for the sensor distance
+ * Tracks distance and its rate of change from the per-measurement median,
+ * giving a low-lag estimate instead of the moving average's
+ * readingSmoothing x measurementInterval delay
+ * Has no Arduino dependencies, so it can be replayed on recorded traces
+ */
+class LevelTracker {
+public:
+  /**
+   * Everything the track depends on, e.g. to carry it across deep sleep
+   */
+  struct State {
+    bool initialized;
+    float distance;
+    float rate;
+    float p00, p01, p11;
+  };
+
+  /**
+   * @param processNoise Acceleration noise density in cm^2/s^3
+   * @param measurementNoise Variance of a median sample in cm^2
+   * @param resetDistance Innovation in cm that restarts the track
+   */
+  LevelTracker(float processNoise, float measurementNoise, float resetDistance);
+
+  /**
+   * Forget the current track
+   */
+  void reset();
+
+  /**
+   * Feed a measurement
+   * @param distance Median distance in cm
+   * @param dt Seconds since the previous measurement
+   */
+  void update(float distance, float dt);
+
+  /**
+   * Copy out the track
+   */
+  State state() const;
+
+  /**
+   * Continue a track copied out by state()
+   */
+  void restore(const State& state);
+
+  bool isInitialized() const { return _initialized; }
+  float distance() const { return _distance; }  // cm
+  float rate() const { return _rate; }          // cm/s, positive when the distance grows (draining)
+
+private:
+  float _processNoise;
+  float _measurementNoise;
+  float _resetDistance;
+  bool _initialized;
+  float _distance;
+  float _rate;
+  float _p00, _p01, _p11;  // Covariance (symmetric)
+};
+
+#endif // LEVEL_TRACKER_H
\ No newline at end of file
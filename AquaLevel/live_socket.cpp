@@ -0,0 +1,160 @@
+#include <ESPAsyncWebServer.h>
+#include "config.h"
+#include "live_socket.h"
+#include "web_interface.h"
+#include "tank_calculator.h"
+
+#define LIVE_SOCKET_MAX_PAIRS 20  // Settings accepted in one "set" command
+
+#define LIVE_SOCKET_CLEANUP_INTERVAL 1000  // Drop clients beyond the connection limit
+
+static AsyncWebSocket liveSocket("/ws");
+static LiveFrame lastFrame;
+static uint32_t frameSequence = 0;
+static unsigned long lastCleanup = 0;
+
+// Fill a frame from the current readings (sequence left to the caller)
+static void buildFrame(LiveFrame& frame) {
+  memset(&frame, 0, sizeof(frame));
+  frame.type = LIVE_FRAME_TANK_DATA;
+  if (lowAlertActive) frame.alerts |= LIVE_ALERT_LOW;
+  if (highAlertActive) frame.alerts |= LIVE_ALERT_HIGH;
+  if (alertsEnabled) frame.alerts |= LIVE_ALERTS_ENABLED;
+  frame.distance = currentDistance;
+  frame.waterLevel = currentWaterLevel;
+  frame.percentage = currentPercentage;
+  frame.volume = currentVolume;
+  frame.fillRate = currentFillRate;
+}
+
+// Apply "name=value&name=value" in /set order, returns the number of accepted settings
+static int applySettingsCommand(const String& query) {
+  String names[LIVE_SOCKET_MAX_PAIRS];
+  String values[LIVE_SOCKET_MAX_PAIRS];
+  int pairCount = 0;
+  
+  int start = 0;
+  while (start < (int)query.length() && pairCount < LIVE_SOCKET_MAX_PAIRS) {
+    int end = query.indexOf('&', start);
+    if (end < 0) end = query.length();
+    
+    String pair = query.substring(start, end);
+    int equals = pair.indexOf('=');
+    if (equals > 0) {
+      names[pairCount] = pair.substring(0, equals);
+      values[pairCount] = pair.substring(equals + 1);
+      pairCount++;
+    }
+    start = end + 1;
+  }
+  
+  int accepted = 0;
+  for (size_t i = 0; i < SETTING_COUNT; i++) {
+    for (int j = 0; j < pairCount; j++) {
+      if (names[j] == SETTING_NAMES[i]) {
+        if (applySetting(names[j], values[j])) {
+          accepted++;
+        }
+        break;
+      }
+    }
+  }
+  
+  // Saved, applied and published from the main loop
+  if (accepted > 0) {
+    scheduleSettingsApply();
+  }
+  return accepted;
+}
+
+static void handleCommand(AsyncWebSocketClient* client, String command) {
+  command.trim();
+  
+  if (command == "get") {
+    LiveFrame frame;
+    buildFrame(frame);
+    frame.sequence = frameSequence;
+    client->binary((const uint8_t*)&frame, sizeof(frame));
+  }
+  else if (command.startsWith("set ")) {
+    int accepted = applySettingsCommand(command.substring(4));
+    if (accepted > 0) {
+      client->text("ok " + String(accepted));
+    } else {
+      client->text("error no settings were changed");
+    }
+  }
+  else if (command.startsWith("calibrate ")) {
+    String type = command.substring(10);
+    if (applyCalibration(type)) {
+      float distance = (type == "empty") ? emptyDistance : fullDistance;
+      client->text("ok " + type + " " + String(distance, 1));
+    } else {
+      client->text("error invalid calibration type");
+    }
+  }
+  else {
+    client->text("error unknown command");
+  }
+}
+
+static void onLiveSocketEvent(AsyncWebSocket* socket, AsyncWebSocketClient* client, AwsEventType type,
+                              void* arg, uint8_t* data, size_t length) {
+  switch (type) {
+    case WS_EVT_CONNECT: {
+      Serial.println("[Live] Client " + client->remoteIP().toString() + " connected (#" + String(client->id()) + ")");
+      
+      // Start with the current state so the client does not wait for the next change
+      LiveFrame frame;
+      buildFrame(frame);
+      frame.sequence = frameSequence;
+      client->binary((const uint8_t*)&frame, sizeof(frame));
+      break;
+    }
+    case WS_EVT_DISCONNECT:
+      Serial.println("[Live] Client #" + String(client->id()) + " disconnected");
+      break;
+    case WS_EVT_DATA: {
+      // Commands are short text messages that arrive in a single frame
+      AwsFrameInfo* info = (AwsFrameInfo*)arg;
+      if (info->final && info->index == 0 && info->len == length && info->opcode == WS_TEXT) {
+        String command;
+        command.concat((const char*)data, length);
+        handleCommand(client, command);
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void setupLiveSocket(AsyncWebServer& server) {
+  liveSocket.onEvent(onLiveSocketEvent);
+  server.addHandler(&liveSocket);
+  
+  Serial.println("Live data WebSocket available at /ws");
+}
+
+void processLiveSocket() {
+  // Free the memory of clients that went away
+  if (millis() - lastCleanup >= LIVE_SOCKET_CLEANUP_INTERVAL) {
+    lastCleanup = millis();
+    liveSocket.cleanupClients();
+  }
+}
+
+void publishLiveData() {
+  LiveFrame frame;
+  buildFrame(frame);
+  
+  // Only send when a value or alert bit actually changed
+  frame.sequence = lastFrame.sequence;
+  if (memcmp(&frame, &lastFrame, sizeof(frame)) == 0) {
+    return;
+  }
+  
+  frame.sequence = ++frameSequence;
+  lastFrame = frame;
+  liveSocket.binaryAll((const uint8_t*)&frame, sizeof(frame));
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+// live_socket.h
+#ifndef LIVE_SOCKET_H
+#define LIVE_SOCKET_H
+
+#include <Arduino.h>
+
+class AsyncWebServer;
+
+// Binary frame type identifiers (first byte of every frame)
+#define LIVE_FRAME_TANK_DATA 1
+
+// Alert bits in LiveFrame.alerts
+#define LIVE_ALERT_LOW      0x01
+#define LIVE_ALERT_HIGH     0x02
+#define LIVE_ALERTS_ENABLED 0x04
+
+/**
+ * Live data frame sent to WebSocket clients (28 bytes, little-endian)
+ * Floats are IEEE 754 single precision
+ */
+struct __attribute__((packed)) LiveFrame {
+  uint8_t type;        // LIVE_FRAME_TANK_DATA
+  uint8_t alerts;      // LIVE_ALERT_* bits
+  uint16_t reserved;
+  uint32_t sequence;   // Incremented for every new frame
+  float distance;      // cm
+  float waterLevel;    // cm
+  float percentage;    // %
+  float volume;        // L
+  float fillRate;      // L/min, negative while draining
+};
+
+/**
+ * Register the live data WebSocket at /ws on the web server
+ *
+ * Clients receive a LiveFrame on connect and whenever the values change.
+ * Text commands are accepted on the same socket and answered with a text
+ * frame starting with "ok" or "error":
+ *   get                          send the current frame
+ *   set name=value&name=value    same names and ranges as /set
+ *   calibrate empty|full         same as /calibrate
+ */
+void setupLiveSocket(AsyncWebServer& server);
+
+/**
+ * Free the memory of closed clients
+ * Should be called regularly in the main loop
+ */
+void processLiveSocket();
+
+/**
+ * Broadcast the tank data to WebSocket clients if it changed
+ * Call after each new water level calculation
+ */
+void publishLiveData();
+
+#endif // LIVE_SOCKET_H
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include <math.h>
+#include "median_filter.h"
+
+// Scales the MAD to the standard deviation of normally distributed noise
+#define MAD_TO_SIGMA 1.4826f
+
+// Need a few samples before the MAD means anything
+#define HAMPEL_MIN_SAMPLES 3
+
+StreamingMedian::StreamingMedian() {
+  reset(MAX_FILTER_WINDOW);
+}
+
+void StreamingMedian::reset(size_t window) {
+  if (window < 1) window = 1;
+  if (window > MAX_FILTER_WINDOW) window = MAX_FILTER_WINDOW;
+  
+  _window = window;
+  _next = 0;
+  _count = 0;
+  
+  // Slots fill the heap positions in the order median, max, min, max, min...
+  for (int i = (int)window - 1; i >= 0; i--) {
+    _pos[i] = ((i + 1) / 2) * ((i & 1) ? -1 : 1);
+    heapAt(_pos[i]) = i;
+  }
+}
+
+// Swaps heap entries i and j if entry i is smaller
+bool StreamingMedian::exchangeIfLess(int i, int j) {
+  if (!less(i, j)) {
+    return false;
+  }
+  int16_t t = heapAt(i);
+  heapAt(i) = heapAt(j);
+  heapAt(j) = t;
+  _pos[heapAt(i)] = i;
+  _pos[heapAt(j)] = j;
+  return true;
+}
+
+// Restores the min-heap downwards, starting at child position i
+// (the median at 0 has a single child on each side, so no sibling check there)
+void StreamingMedian::minSortDown(int i) {
+  for (; i <= minCount(); i *= 2) {
+    if (i > 1 && i < minCount() && less(i + 1, i)) {
+      ++i;
+    }
+    if (!exchangeIfLess(i, i / 2)) {
+      break;
+    }
+  }
+}
+
+// Restores the max-heap downwards, starting at child position i (negative)
+void StreamingMedian::maxSortDown(int i) {
+  for (; i >= -maxCount(); i *= 2) {
+    if (i < -1 && i > -maxCount() && less(i, i - 1)) {
+      --i;
+    }
+    if (!exchangeIfLess(i / 2, i)) {
+      break;
+    }
+  }
+}
+
+// Restores the min-heap above position i; true if it reached the median
+bool StreamingMedian::minSortUp(int i) {
+  while (i > 0 && exchangeIfLess(i, i / 2)) {
+    i /= 2;
+  }
+  return i == 0;
+}
+
+// Restores the max-heap above position i; true if it reached the median
+bool StreamingMedian::maxSortUp(int i) {
+  while (i < 0 && exchangeIfLess(i / 2, i)) {
+    i /= 2;
+  }
+  return i == 0;
+}
+
+void StreamingMedian::push(float value) {
+  bool isNew = _count < _window;
+  int p = _pos[_next];
+  float old = _data[_next];
+  
+  _data[_next] = value;
+  _next = (_next + 1) % _window;
+  if (isNew) {
+    _count++;
+  }
+  
+  if (p > 0) {
+    // Slot lives in the min-heap
+    if (!isNew && old < value) {
+      minSortDown(p * 2);
+    } else if (minSortUp(p)) {
+      maxSortDown(-1);
+    }
+  } else if (p < 0) {
+    // Slot lives in the max-heap
+    if (!isNew && value < old) {
+      maxSortDown(p * 2);
+    } else if (maxSortUp(p)) {
+      minSortDown(1);
+    }
+  } else {
+    // Slot is the median itself
+    if (maxCount()) {
+      maxSortDown(-1);
+    }
+    if (minCount()) {
+      minSortDown(1);
+    }
+  }
+}
+
+float StreamingMedian::median() const {
+  if (_count == 0) {
+    return 0;
+  }
+  
+  float value = _data[heapAt(0)];
+  if ((_count & 1) == 0) {
+    value = (value + _data[heapAt(-1)]) / 2.0f;
+  }
+  return value;
+}
+
+void HampelFilter::reset(size_t window, float threshold, float minSigma) {
+  _values.reset(window);
+  _deviations.reset(window);
+  _threshold = threshold;
+  _minSigma = minSigma;
+}
+
+float HampelFilter::filter(float value, bool* outlier) {
+  bool rejected = false;
+  float median = _values.median();
+  float deviation = fabsf(value - median);
+  
+  if (_threshold > 0 && _values.count() >= HAMPEL_MIN_SAMPLES) {
+    float sigma = fmaxf(MAD_TO_SIGMA * _deviations.median(), _minSigma);
+    rejected = deviation > _threshold * sigma;
+  }
+  
+  // The raw sample always enters the window so a real level change
+  // takes over the median after half a window instead of being rejected forever
+  _values.push(value);
+  _deviations.push(_values.count() > 1 ? deviation : 0);
+  
+  if (outlier != NULL) {
+    *outlier = rejected;
+  }
+  
+  // Without a threshold the filter is a plain running median
+  if (_threshold <= 0) {
+    return _values.median();
+  }
+  return rejected ? median : value;
+}
\ No newline at end of file
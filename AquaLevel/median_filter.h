@@ -0,0 +1,99 @@
+// median_filter.h
+#ifndef MEDIAN_FILTER_H
+#define MEDIAN_FILTER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Largest window supported by the streaming filters
+#define MAX_FILTER_WINDOW 31
+
+/**
+ * Sliding-window median in O(log n) per sample
+ * Two heaps (max-heap below the median, min-heap above it) share one index
+ * array, and every window slot remembers its heap position so the sample
+ * leaving the window is replaced in place instead of searched for
+ */
+class StreamingMedian {
+public:
+  StreamingMedian();
+
+  /**
+   * Clear the window and set its size (clamped to 1..MAX_FILTER_WINDOW)
+   */
+  void reset(size_t window);
+
+  /**
+   * Add a sample, evicting the oldest once the window is full
+   */
+  void push(float value);
+
+  /**
+   * Get the median of the samples in the window (0 if empty)
+   */
+  float median() const;
+
+  size_t count() const { return _count; }
+  size_t window() const { return _window; }
+
+private:
+  float _data[MAX_FILTER_WINDOW];       // Samples in arrival order (circular)
+  int16_t _pos[MAX_FILTER_WINDOW];      // Heap position of each sample slot
+  int16_t _heap[MAX_FILTER_WINDOW];     // Slot indexes; centre entry is the median
+  size_t _window;
+  size_t _next;                         // Slot the next sample is written to
+  size_t _count;
+
+  int16_t& heapAt(int i) { return _heap[_window / 2 + i]; }
+  int16_t heapAt(int i) const { return _heap[_window / 2 + i]; }
+  int minCount() const { return ((int)_count - 1) / 2; }
+  int maxCount() const { return (int)_count / 2; }
+  bool less(int i, int j) const { return _data[heapAt(i)] < _data[heapAt(j)]; }
+  bool exchangeIfLess(int i, int j);
+  void minSortDown(int i);
+  void maxSortDown(int i);
+  bool minSortUp(int i);
+  bool maxSortUp(int i);
+};
+
+/**
+ * Hampel outlier filter on top of a streaming median
+ * A sample further than threshold * 1.4826 * MAD from the window median
+ * is reported as an outlier and replaced by the median. The MAD is
+ * tracked by a second streaming median over each sample's deviation from
+ * the median at the time it arrived, which keeps both updates O(log n)
+ * Sigma never drops below minSigma, so while the window holds identical
+ * readings (MAD 0) a one-step change is not taken for an outlier
+ */
+class HampelFilter {
+public:
+  /**
+   * Clear the filter and configure it
+   * @param window Samples in the sliding window
+   * @param threshold Outlier threshold in scaled MADs (0 disables rejection)
+   * @param minSigma Smallest sigma used, e.g. one step of the sensor's resolution
+   */
+  void reset(size_t window, float threshold, float minSigma = 0);
+
+  /**
+   * Filter a sample
+   * @param value Raw sample
+   * @param outlier Set to true if the sample was rejected (may be NULL)
+   * @return The sample itself, or the window median if it was rejected
+   *         (with rejection disabled, always the running window median)
+   */
+  float filter(float value, bool* outlier);
+
+  float median() const { return _values.median(); }
+  size_t count() const { return _values.count(); }
+  size_t window() const { return _values.window(); }
+  float threshold() const { return _threshold; }
+
+private:
+  StreamingMedian _values;
+  StreamingMedian _deviations;
+  float _threshold = 0;
+  float _minSigma = 0;
+};
+
+#endif // MEDIAN_FILTER_H
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include "config.h"
+#include "power_manager.h"
+#include "sensor_manager.h"
+#include "tank_calculator.h"
+#include "wifi_manager.h"
+#include "history_manager.h"
+#include "eeprom_manager.h"
+
+#define RTC_STATE_MAGIC 0x41514C56  // "AQLV"
+
+// State carried across deep sleep (RTC slow memory survives, main RAM does not)
+struct RtcState {
+  uint32_t magic;
+  uint32_t wakeCount;
+  uint32_t lastAwakeMs;
+  uint8_t smoothingCount;
+  float smoothing[MAX_READING_SMOOTHING];
+  bool lowAlertActive;
+  bool highAlertActive;
+  float distance;
+  float waterLevel;
+  float percentage;
+  float volume;
+  LevelTracker::State tracker;
+  uint32_t trackerAge;  // Milliseconds from the tracker's last update to the wake
+};
+
+RTC_DATA_ATTR static RtcState rtcState;
+
+static bool wokeFromSleep = false;
+
+void setupPowerManager() {
+  wokeFromSleep = (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER) && rtcState.magic == RTC_STATE_MAGIC;
+  
+  if (!wokeFromSleep) {
+    // Cold boot: RTC memory holds nothing useful
+    memset(&rtcState, 0, sizeof(rtcState));
+    rtcState.magic = RTC_STATE_MAGIC;
+    
+    if (lowPowerMode) {
+      Serial.println("[Power] Low-power mode, staying awake " + String(LOW_POWER_BOOT_WINDOW) + " s for setup");
+    }
+    return;
+  }
+  
+  rtcState.wakeCount++;
+  
+  // Restore the smoothing buffer, level track, alert latches and last-known level
+  restoreSmoothingSamples(rtcState.smoothing, rtcState.smoothingCount);
+  restoreTrackerState(rtcState.tracker, rtcState.trackerAge);
+  lowAlertActive = rtcState.lowAlertActive;
+  highAlertActive = rtcState.highAlertActive;
+  currentDistance = rtcState.distance;
+  currentWaterLevel = rtcState.waterLevel;
+  currentPercentage = rtcState.percentage;
+  currentVolume = rtcState.volume;
+  
+  Serial.println("[Power] Woke from deep sleep #" + String(rtcState.wakeCount) +
+                 ", previous cycle awake " + String(rtcState.lastAwakeMs) + " ms");
+}
+
+void processPowerManager() {
+  // Wait for a finished measurement (valid or not, a dead sensor must not drain the battery)
+  SensorResult result = getLastSensorResult();
+  if (!lowPowerMode || result.timestamp == 0 || isSensorBusy()) {
+    return;
+  }
+  
+  // Never sleep on a device that has not been set up yet
+  if (wifiManager.getMode() == WIFI_MANAGER_MODE_AP) {
+    return;
+  }
+  
+  // Let a connection attempt in progress finish (bounded by its timeout)
+  WifiConnectionState wifiState = wifiManager.getConnectionState();
+  if (wifiState == WIFI_STATE_FAST_CONNECT || wifiState == WIFI_STATE_CONNECTING) {
+    return;
+  }
+  
+  // Stay reachable for a while after power-on, then briefly after each measurement
+  unsigned long now = millis();
+  if (!wokeFromSleep && now < LOW_POWER_BOOT_WINDOW * 1000UL) {
+    return;
+  }
+  if (now - result.timestamp < LOW_POWER_AWAKE_WINDOW * 1000UL) {
+    return;
+  }
+  
+  // Keep what the next wake needs in RTC memory
+  rtcState.smoothingCount = getSmoothingSamples(rtcState.smoothing, MAX_READING_SMOOTHING);
+  rtcState.tracker = getTrackerState(rtcState.trackerAge);
+  rtcState.trackerAge += measurementInterval * 1000UL;
+  rtcState.lowAlertActive = lowAlertActive;
+  rtcState.highAlertActive = highAlertActive;
+  rtcState.distance = currentDistance;
+  rtcState.waterLevel = currentWaterLevel;
+  rtcState.percentage = currentPercentage;
+  rtcState.volume = currentVolume;
+  rtcState.lastAwakeMs = millis();
+  saveHistory(false);
+  flushSettings();
+  
+  Serial.println("[Power] Awake for " + String(rtcState.lastAwakeMs) + " ms, sleeping " +
+                 String(measurementInterval) + " s");
+  Serial.flush();
+  
+  WiFi.disconnect(true);
+  WiFi.mode(WIFI_OFF);
+  
+  esp_sleep_enable_timer_wakeup((uint64_t)measurementInterval * 1000000ULL);
+  esp_deep_sleep_start();
+}
+
+bool wokeFromDeepSleep() {
+  return wokeFromSleep;
+}
+
+uint32_t getLastAwakeTime() {
+  return rtcState.lastAwakeMs;
+}
+
+uint32_t getWakeCount() {
+  return rtcState.wakeCount;
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+// power_manager.h
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+
+/**
+ * Initialize the power manager and restore state kept in RTC memory
+ * Call after the sensor and tank calculator are set up
+ */
+void setupPowerManager();
+
+/**
+ * Enter deep sleep once the wake cycle is done (low-power mode only)
+ * Should be called regularly in the main loop
+ */
+void processPowerManager();
+
+/**
+ * Check if this boot was a wake from deep sleep
+ */
+bool wokeFromDeepSleep();
+
+/**
+ * Get the wake-to-sleep time of the previous wake cycle
+ * @return Milliseconds, 0 if there was none
+ */
+uint32_t getLastAwakeTime();
+
+/**
+ * Get the number of deep sleep wakes since power-on
+ */
+uint32_t getWakeCount();
+
+#endif // POWER_MANAGER_H
\ No newline at end of file
@@ -0,0 +1,89 @@
+// ring_buffer.h
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <stddef.h>
+
+/**
+ * Fixed-capacity ring buffer with an incrementally maintained sum
+ * Storage is a member array, so instances can be statically allocated
+ * and resized at runtime without touching the heap
+ * Push and average are O(1) regardless of the window size
+ */
+template <typename T, size_t Capacity, typename SumT = double>
+class RingBuffer {
+public:
+  RingBuffer() : _size(Capacity), _head(0), _count(0), _sum(0) {}
+
+  /**
+   * Change the active window size (clamped to 1..Capacity)
+   * Keeps the newest samples that still fit in the new window
+   */
+  void resize(size_t size) {
+    if (size < 1) size = 1;
+    if (size > Capacity) size = Capacity;
+    if (size == _size) return;
+
+    // Copy out the newest samples, oldest first
+    size_t keep = _count < size ? _count : size;
+    T newest[Capacity];
+    for (size_t i = 0; i < keep; i++) {
+      newest[i] = at(_count - keep + i);
+    }
+
+    _size = size;
+    clear();
+    for (size_t i = 0; i < keep; i++) {
+      push(newest[i]);
+    }
+  }
+
+  /**
+   * Drop all samples, keeping the window size
+   */
+  void clear() {
+    _head = 0;
+    _count = 0;
+    _sum = 0;
+  }
+
+  /**
+   * Add a sample, overwriting the oldest once the window is full
+   */
+  void push(T value) {
+    if (_count == _size) {
+      _sum -= _data[_head];
+    } else {
+      _count++;
+    }
+    _data[_head] = value;
+    _sum += value;
+    _head = (_head + 1) % _size;
+  }
+
+  /**
+   * Get a sample by age order
+   * @param index 0 is the oldest sample, count() - 1 the newest
+   */
+  T at(size_t index) const {
+    return _data[(_head + _size - _count + index) % _size];
+  }
+
+  T newest() const { return at(_count - 1); }
+  SumT sum() const { return _sum; }
+  T average() const { return _count > 0 ? (T)(_sum / _count) : (T)0; }
+  size_t count() const { return _count; }
+  size_t size() const { return _size; }
+  bool isEmpty() const { return _count == 0; }
+  bool isFull() const { return _count == _size; }
+  static size_t capacity() { return Capacity; }
+
+private:
+  T _data[Capacity];
+  size_t _size;   // Active window size
+  size_t _head;   // Next slot to write
+  size_t _count;  // Valid samples in the window
+  SumT _sum;      // Running sum of the valid samples
+};
+
+#endif // RING_BUFFER_H
\ No newline at end of file
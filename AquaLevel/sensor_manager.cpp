@@ -2,11 +2,103 @@
 #include <Arduino.h>
 #include "config.h"
 #include "sensor_manager.h"
+#include "ring_buffer.h"
+#include "median_filter.h"
+#include "level_tracker.h"
 
-// Buffer for smoothing sensor readings - changed from fixed array to dynamic
-float* distanceReadings = NULL;
-int readingIndex = 0;
-int currentSmoothingSize = 0;
+// Echo capture constants
+#define ECHO_TIMEOUT_US 30000      // Max echo wait (~5m round trip), matches the old pulseIn timeout
+#define ECHO_QUEUE_LENGTH 4        // Completed echoes waiting to be collected
+#define SHOT_SPACING_US 10000      // Gap between shots so late echoes die out
+#define SHOTS_PER_READING 3        // Shots reduced to one median reading
+
+// Speed of sound lookup table range (1 degree C steps)
+#define SOUND_TABLE_MIN_C -40
+#define SOUND_TABLE_MAX_C 85
+#define SOUND_TABLE_SIZE (SOUND_TABLE_MAX_C - SOUND_TABLE_MIN_C + 1)
+
+// A completed echo, delivered from the ISR through echoQueue
+struct EchoSample {
+  uint32_t pingId;      // Ping this echo belongs to (stale echoes are dropped)
+  uint32_t durationUs;  // Echo pulse width in microseconds
+};
+
+// Echo capture state shared with the ISR
+static QueueHandle_t echoQueue = NULL;
+static volatile uint32_t echoRiseMicros = 0;
+static volatile uint32_t echoPingId = 0;
+static volatile bool echoArmed = false;
+
+// Ping bookkeeping (main loop only)
+static bool pingInFlight = false;
+static uint32_t pingStartMicros = 0;
+
+// Measurement state machine, advanced by sensorTick()
+static SensorState sensorState = SENSOR_IDLE;
+static float shotReadings[SHOTS_PER_READING];
+static int shotIndex = 0;
+static uint32_t settleStartMicros = 0;
+static SensorResult lastResult = { -1, -1, 0, 0, 0, false };
+
+// Streaming median + Hampel outlier rejection over the last filterWindow shots
+static HampelFilter shotFilter;
+
+// Low-lag distance and rate estimate fed by every valid median
+static LevelTracker levelTracker(LEVEL_TRACKER_PROCESS_NOISE, LEVEL_TRACKER_MEASUREMENT_NOISE,
+                                 LEVEL_TRACKER_RESET_DISTANCE);
+static unsigned long lastTrackerUpdate = 0;
+
+// One-way distance per microsecond of echo (cm/µs, already halved) by air temperature
+static float soundFactorTable[SOUND_TABLE_SIZE];
+static float soundFactor = 0.0343 / 2.0;
+static float soundFactorTemperature = NAN;
+
+// Buffer for smoothing sensor readings - statically allocated, resized in place
+static RingBuffer<float, MAX_READING_SMOOTHING> distanceReadings;
+
+// Speed of sound in air: c = 331.3 * sqrt(1 + T / 273.15) m/s
+static void buildSoundFactorTable() {
+  for (int i = 0; i < SOUND_TABLE_SIZE; i++) {
+    float temperature = SOUND_TABLE_MIN_C + i;
+    float speed = 331.3 * sqrt(1.0 + temperature / 273.15); // m/s
+    soundFactorTable[i] = speed * 0.0001 / 2.0;               // cm/µs, halved for the round trip
+  }
+}
+
+void updateSoundSpeed(float temperature) {
+  if (temperature == soundFactorTemperature) {
+    return;
+  }
+  soundFactorTemperature = temperature;
+  
+  // Clamp to the table and interpolate between whole degrees
+  float position = constrain(temperature, (float)SOUND_TABLE_MIN_C, (float)SOUND_TABLE_MAX_C) - SOUND_TABLE_MIN_C;
+  int index = (int)position;
+  if (index >= SOUND_TABLE_SIZE - 1) {
+    soundFactor = soundFactorTable[SOUND_TABLE_SIZE - 1];
+  } else {
+    float fraction = position - index;
+    soundFactor = soundFactorTable[index] + fraction * (soundFactorTable[index + 1] - soundFactorTable[index]);
+  }
+}
+
+// Timestamps both echo edges; the falling edge completes the ping
+void IRAM_ATTR echoISR() {
+  uint32_t now = micros();
+  
+  if (digitalRead(ECHO_PIN) == HIGH) {
+    echoRiseMicros = now;
+  } else if (echoArmed && echoRiseMicros != 0) {
+    EchoSample sample = { echoPingId, now - echoRiseMicros };
+    echoArmed = false;
+    
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    xQueueSendFromISR(echoQueue, &sample, &higherPriorityTaskWoken);
+    if (higherPriorityTaskWoken) {
+      portYIELD_FROM_ISR();
+    }
+  }
+}
 
 void setupSensor() {
   Serial.println("Initializing ultrasonic sensor...");
@@ -14,9 +106,22 @@ void setupSensor() {
   // Set pin modes for HC-SR04
   pinMode(TRIGGER_PIN, OUTPUT);
   pinMode(ECHO_PIN, INPUT);
+  digitalWrite(TRIGGER_PIN, LOW);
+  
+  // Precompute the speed of sound so compensation costs one multiply per shot
+  buildSoundFactorTable();
+  updateSoundSpeed(currentAirTemperature);
+  
+  // Echo pulses are captured by the edge ISR and handed over through a queue
+  echoQueue = xQueueCreate(ECHO_QUEUE_LENGTH, sizeof(EchoSample));
+  if (echoQueue == NULL) {
+    Serial.println("ERROR: Failed to create echo queue!");
+  }
+  attachInterrupt(digitalPinToInterrupt(ECHO_PIN), echoISR, CHANGE);
   
   // Initialize readings buffer with current smoothing value
   updateSmoothingBuffer();
+  updateShotFilter();
   
   Serial.print("Ultrasonic sensor initialized on pins Trigger:");
   Serial.print(TRIGGER_PIN);
@@ -24,33 +129,95 @@ void setupSensor() {
   Serial.println(ECHO_PIN);
   Serial.print("Smoothing level: ");
   Serial.println(readingSmoothing);
+  Serial.print("Filter window: ");
+  Serial.print(filterWindow);
+  Serial.print(", Hampel threshold: ");
+  Serial.println(hampelThreshold);
 }
 
-// New function to update smoothing buffer when setting changes
+// Update smoothing window when setting changes
 void updateSmoothingBuffer() {
-  // Only reallocate if the size has changed
-  if (currentSmoothingSize != readingSmoothing) {
-    // Free previous buffer if it exists
-    if (distanceReadings != NULL) {
-      free(distanceReadings);
-    }
-    
-    // Allocate new buffer of the correct size
-    distanceReadings = (float*)malloc(readingSmoothing * sizeof(float));
-    currentSmoothingSize = readingSmoothing;
-    
-    // Reset index and initialize buffer with zeros
-    readingIndex = 0;
-    for (int i = 0; i < readingSmoothing; i++) {
-      distanceReadings[i] = 0;
-    }
+  // Only resize if the size has changed
+  if ((int)distanceReadings.size() != readingSmoothing) {
+    // Keeps the newest readings, no heap allocation involved
+    distanceReadings.resize(readingSmoothing);
     
     Serial.print("Smoothing buffer updated to size: ");
     Serial.println(readingSmoothing);
   }
 }
 
-float getSingleReading() {
+size_t getSmoothingSamples(float* samples, size_t maxSamples) {
+  size_t count = min(distanceReadings.count(), maxSamples);
+  size_t skip = distanceReadings.count() - count;
+  for (size_t i = 0; i < count; i++) {
+    samples[i] = distanceReadings.at(skip + i);
+  }
+  return count;
+}
+
+void restoreSmoothingSamples(const float* samples, size_t count) {
+  distanceReadings.clear();
+  for (size_t i = 0; i < count; i++) {
+    distanceReadings.push(samples[i]);
+  }
+}
+
+LevelTracker::State getTrackerState(uint32_t& age) {
+  age = millis() - lastTrackerUpdate;
+  return levelTracker.state();
+}
+
+void restoreTrackerState(const LevelTracker::State& state, uint32_t age) {
+  levelTracker.restore(state);
+  
+  // millis() restarted at the wake; the next dt still spans the sleep
+  lastTrackerUpdate = millis() - age;
+  if (state.initialized) {
+    trackedDistance = state.distance;
+    distanceRate = state.rate;
+  }
+}
+
+// Reconfigure the outlier filter when its settings change
+void updateShotFilter() {
+  if ((int)shotFilter.window() != filterWindow || shotFilter.threshold() != hampelThreshold) {
+    shotFilter.reset(filterWindow, hampelThreshold, SENSOR_RESOLUTION);
+    
+    Serial.print("Shot filter updated to window: ");
+    Serial.println(filterWindow);
+  }
+}
+
+// Convert an echo pulse width to a validated distance
+static float durationToDistance(uint32_t duration) {
+  // Calculate distance in centimeters
+  // Speed of sound depends on air temperature (343 m/s = 0.0343 cm/µs at 20 C)
+  // Distance = (duration x speed) / 2 (divide by 2 for round trip, folded into soundFactor)
+  float distance = duration * soundFactor;
+  
+  // Validate reading - HC-SR04 typically measures 2cm to 400cm
+  if (distance <= 0 || distance > 400) {
+    Serial.println("Invalid distance reading: " + String(distance) + " cm");
+    return -1; // Invalid reading
+  }
+  
+  return distance;
+}
+
+bool triggerPing() {
+  if (pingInFlight || echoQueue == NULL) {
+    return false;
+  }
+  
+  // Drop anything left over from an earlier ping
+  xQueueReset(echoQueue);
+  
+  // Arm the ISR before the trigger so the rising edge is not missed
+  echoPingId++;
+  echoRiseMicros = 0;
+  echoArmed = true;
+  
   // Clear trigger pin
   digitalWrite(TRIGGER_PIN, LOW);
   delayMicroseconds(2);
@@ -60,84 +227,206 @@ float getSingleReading() {
   delayMicroseconds(10);
   digitalWrite(TRIGGER_PIN, LOW);
   
-  // Read echo pin (pulse duration in microseconds)
-  unsigned long duration = pulseIn(ECHO_PIN, HIGH, 30000); // Timeout after 30ms
+  pingStartMicros = micros();
+  pingInFlight = true;
+  return true;
+}
+
+bool pollPing(float* distance) {
+  if (!pingInFlight) {
+    return false;
+  }
   
-  // Calculate distance in centimeters
-  // Speed of sound = 343 m/s = 0.0343 cm/µs
-  // Distance = (duration x 0.0343) / 2 (divide by 2 for round trip)
-  float distance = (duration * 0.0343) / 2.0;
+  EchoSample sample;
+  while (xQueueReceive(echoQueue, &sample, 0) == pdTRUE) {
+    if (sample.pingId == echoPingId) {
+      pingInFlight = false;
+      *distance = durationToDistance(sample.durationUs);
+      return true;
+    }
+  }
   
-  // Validate reading - HC-SR04 typically measures 2cm to 400cm
-  if (distance <= 0 || distance > 400) {
-    Serial.println("Invalid distance reading: " + String(distance) + " cm");
-    return -1; // Invalid reading
+  // No echo within the timeout (out of range or no target)
+  if (micros() - pingStartMicros > ECHO_TIMEOUT_US) {
+    echoArmed = false;
+    pingInFlight = false;
+    *distance = durationToDistance(0);
+    return true;
   }
   
-  return distance;
+  return false;
+}
+
+float getSingleReading() {
+  if (!triggerPing()) {
+    return -1;
+  }
+  
+  // Sleep on the queue rather than spinning; the echo ISR wakes us up
+  EchoSample sample;
+  TickType_t timeoutTicks = pdMS_TO_TICKS(ECHO_TIMEOUT_US / 1000) + 1;
+  while (xQueueReceive(echoQueue, &sample, timeoutTicks) == pdTRUE) {
+    if (sample.pingId == echoPingId) {
+      pingInFlight = false;
+      return durationToDistance(sample.durationUs);
+    }
+  }
+  
+  echoArmed = false;
+  pingInFlight = false;
+  return durationToDistance(0);
 }
 
-void readSensorDistance() {
-  // Check if smoothing size has changed and update buffer if needed
-  if (currentSmoothingSize != readingSmoothing) {
-    updateSmoothingBuffer();
+void startSensorReading() {
+  // Ignore the request if a measurement is still running
+  if (sensorState != SENSOR_IDLE) {
+    return;
   }
   
-  // Take multiple readings and average them
-  float validReadings = 0;
-  float totalDistance = 0;
+  // Check if smoothing size or filter settings have changed
+  updateSmoothingBuffer();
+  updateShotFilter();
   
-  // Take 3 readings and use the median (to filter out anomalies)
-  float readings[3];
+  // Pick up the latest air temperature for this measurement
+  updateSoundSpeed(currentAirTemperature);
   
-  for (int i = 0; i < 3; i++) {
-    readings[i] = getSingleReading();
-    delay(10); // Small delay between readings
+  shotIndex = 0;
+  sensorState = SENSOR_TRIGGER;
+}
+
+// Outlier filter, median of the shots, then the moving average;
+// the last step of a measurement
+static bool reduceShots() {
+  // Run every valid shot through the streaming Hampel filter
+  float cleaned[SHOTS_PER_READING];
+  uint8_t validShots = 0;
+  uint8_t rejectedShots = 0;
+  
+  for (int i = 0; i < SHOTS_PER_READING; i++) {
+    if (shotReadings[i] <= 0) continue;
+    
+    bool outlier = false;
+    cleaned[validShots++] = shotFilter.filter(shotReadings[i], &outlier);
+    if (outlier) rejectedShots++;
   }
   
   // Sort readings
-  for (int i = 0; i < 2; i++) {
-    for (int j = 0; j < 2 - i; j++) {
-      if (readings[j] > readings[j + 1]) {
-        float temp = readings[j];
-        readings[j] = readings[j + 1];
-        readings[j + 1] = temp;
+  for (int i = 0; i < validShots - 1; i++) {
+    for (int j = 0; j < validShots - 1 - i; j++) {
+      if (cleaned[j] > cleaned[j + 1]) {
+        float temp = cleaned[j];
+        cleaned[j] = cleaned[j + 1];
+        cleaned[j + 1] = temp;
       }
     }
   }
   
   // Use median reading (middle value)
-  float medianReading = readings[1];
+  float medianReading = validShots > 0 ? cleaned[validShots / 2] : -1;
+  
+  lastResult.median = medianReading;
+  lastResult.validShots = validShots;
+  lastResult.rejectedShots = rejectedShots;
+  lastResult.timestamp = millis();
+  lastResult.valid = false;
   
   // Check if median reading is valid
-  if (medianReading > 0) {
-    // Add to smoothing buffer
-    distanceReadings[readingIndex] = medianReading;
-    readingIndex = (readingIndex + 1) % readingSmoothing;
-    
-    // Calculate smoothed average
-    totalDistance = 0;
-    validReadings = 0;
-    
-    for (int i = 0; i < readingSmoothing; i++) {
-      if (distanceReadings[i] > 0) {
-        totalDistance += distanceReadings[i];
-        validReadings++;
+  if (medianReading <= 0) {
+    Serial.println("Failed to get valid reading");
+    return false;
+  }
+  
+  if (rejectedShots > 0) {
+    Serial.println("Rejected " + String(rejectedShots) + " outlier shot(s)");
+  }
+  
+  // Feed the tracker before smoothing so it sees the un-lagged signal
+  float dt = levelTracker.isInitialized() ? (lastResult.timestamp - lastTrackerUpdate) / 1000.0 : 0;
+  levelTracker.update(medianReading, dt);
+  lastTrackerUpdate = lastResult.timestamp;
+  trackedDistance = levelTracker.distance();
+  distanceRate = levelTracker.rate();
+  
+  // Add to smoothing buffer; the running sum makes the average O(1)
+  distanceReadings.push(medianReading);
+  float smoothedDistance = distanceReadings.average();
+  
+  // Update global current distance
+  currentDistance = smoothedDistance;
+  lastResult.smoothed = smoothedDistance;
+  lastResult.valid = true;
+  
+  // Debug output
+  Serial.print("Distance: ");
+  Serial.print(smoothedDistance);
+  Serial.println(" cm");
+  return true;
+}
+
+bool sensorTick() {
+  switch (sensorState) {
+    case SENSOR_IDLE:
+      return false;
+      
+    case SENSOR_TRIGGER:
+      if (echoQueue == NULL) {
+        // No echo can ever arrive; finish as a measurement without valid shots
+        for (int i = 0; i < SHOTS_PER_READING; i++) {
+          shotReadings[i] = -1;
+        }
+        shotIndex = SHOTS_PER_READING;
+        sensorState = SENSOR_REDUCE;
+      } else if (triggerPing()) {
+        sensorState = SENSOR_WAIT_ECHO;
       }
-    }
-    
-    if (validReadings > 0) {
-      float smoothedDistance = totalDistance / validReadings;
+      return false;
       
-      // Update global current distance
-      currentDistance = smoothedDistance;
+    case SENSOR_WAIT_ECHO: {
+      float distance;
+      if (!pollPing(&distance)) {
+        return false;
+      }
+      shotReadings[shotIndex++] = distance;
       
-      // Debug output
-      Serial.print("Distance: ");
-      Serial.print(smoothedDistance);
-      Serial.println(" cm");
+      if (shotIndex < SHOTS_PER_READING) {
+        settleStartMicros = micros();
+        sensorState = SENSOR_SETTLE;
+      } else {
+        sensorState = SENSOR_REDUCE;
+      }
+      return false;
     }
-  } else {
-    Serial.println("Failed to get valid reading");
+    
+    case SENSOR_SETTLE:
+      // Small gap between shots so late echoes die out
+      if (micros() - settleStartMicros >= SHOT_SPACING_US) {
+        sensorState = SENSOR_TRIGGER;
+      }
+      return false;
+      
+    case SENSOR_REDUCE:
+      sensorState = SENSOR_IDLE;
+      return reduceShots();
   }
+  
+  return false;
+}
+
+SensorState getSensorState() {
+  return sensorState;
+}
+
+bool isSensorBusy() {
+  return sensorState != SENSOR_IDLE;
+}
+
+uint8_t getSensorProgress() {
+  if (sensorState == SENSOR_IDLE) {
+    return 100;
+  }
+  return (uint8_t)(shotIndex * 100 / (SHOTS_PER_READING + 1));
+}
+
+SensorResult getLastSensorResult() {
+  return lastResult;
 }
\ No newline at end of file
@@ -3,6 +3,28 @@
 #ifndef SENSOR_MANAGER_H
 #define SENSOR_MANAGER_H
 
+#include <Arduino.h>
+#include "level_tracker.h"
+
+// Measurement state machine steps
+enum SensorState {
+  SENSOR_IDLE,       // Waiting for the next measurement to be started
+  SENSOR_TRIGGER,    // Fire the next shot
+  SENSOR_WAIT_ECHO,  // Shot in flight, echo captured by interrupt
+  SENSOR_SETTLE,     // Gap between shots so late echoes die out
+  SENSOR_REDUCE      // Median + smoothing of the collected shots
+};
+
+// Outcome of the last completed measurement
+struct SensorResult {
+  float median;        // Median of the shots in cm (-1 if invalid)
+  float smoothed;      // Moving-average distance in cm
+  uint8_t validShots;  // Shots that returned a usable echo
+  uint8_t rejectedShots;  // Shots replaced by the Hampel filter
+  unsigned long timestamp;  // millis() when the measurement completed
+  bool valid;          // true if the median was usable
+};
+
 /**
  * Initialize the ultrasonic sensor
  */
@@ -13,16 +35,96 @@ void setupSensor();
  */
 void updateSmoothingBuffer();
 
+/**
+ * Copy the smoothing buffer out, oldest sample first
+ * @param samples Destination array
+ * @param maxSamples Size of the destination array
+ * @return Number of samples copied
+ */
+size_t getSmoothingSamples(float* samples, size_t maxSamples);
+
+/**
+ * Refill the smoothing buffer, oldest sample first (e.g. after deep sleep)
+ */
+void restoreSmoothingSamples(const float* samples, size_t count);
+
+/**
+ * Copy out the level tracker's track
+ * @param age Set to the milliseconds since its last update
+ */
+LevelTracker::State getTrackerState(uint32_t& age);
+
+/**
+ * Continue a track copied out by getTrackerState() (e.g. after deep sleep)
+ * @param age Milliseconds between its last update and now
+ */
+void restoreTrackerState(const LevelTracker::State& state, uint32_t age);
+
+/**
+ * Updates the streaming median/Hampel filter when its settings change
+ */
+void updateShotFilter();
+
+/**
+ * Set the air temperature used for the speed of sound
+ * Interpolates the precomputed table; a no-op if the temperature is unchanged
+ * @param temperature Air temperature in degrees C
+ */
+void updateSoundSpeed(float temperature);
+
+/**
+ * Fire a trigger pulse; the echo is captured by the edge interrupt
+ * @return false if a ping is already in flight
+ */
+bool triggerPing();
+
+/**
+ * Collect the result of the ping in flight without blocking
+ * @param distance Set to the distance in centimeters, or -1 if invalid/timed out
+ * @return true once the ping has completed
+ */
+bool pollPing(float* distance);
+
 /**
  * Take a single distance reading
+ * Sleeps on the echo queue until the echo arrives (up to 30ms)
  * @return Distance in centimeters, or -1 if invalid reading
  */
 float getSingleReading();
 
 /**
- * Read sensor and update the global currentDistance variable
+ * Start a new multi-shot measurement (ignored while one is running)
+ */
+void startSensorReading();
+
+/**
+ * Advance the measurement state machine by one step and update the
+ * global currentDistance variable when a measurement completes
+ * Each step takes microseconds; call from every loop pass
  * Uses smoothing and filtering to improve accuracy
+ * @return true when a new smoothed reading was stored
+ */
+bool sensorTick();
+
+/**
+ * Get the current step of the measurement state machine
+ */
+SensorState getSensorState();
+
+/**
+ * Check if a measurement is in progress
+ */
+bool isSensorBusy();
+
+/**
+ * Get the progress of the current measurement
+ * @return 0-100 percent, 100 when idle
+ */
+uint8_t getSensorProgress();
+
+/**
+ * Get the outcome of the last completed measurement
  */
-void readSensorDistance();
+SensorResult getLastSensorResult();
 
 #endif // SENSOR_MANAGER_H
\ No newline at end of file
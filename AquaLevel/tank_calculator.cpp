@@ -54,8 +54,11 @@ void setupTankCalculator() {
 }
 
 void calculateWaterLevel() {
+  // Use the low-lag tracker estimate when enabled, the moving average otherwise
+  float distance = (levelTrackerEnabled && trackedDistance > 0) ? trackedDistance : currentDistance;
+  
   // Skip calculation if distance reading is invalid
-  if (currentDistance <= 0) {
+  if (distance <= 0) {
     return;
   }
   
@@ -64,12 +67,12 @@ void calculateWaterLevel() {
   // When the sensor reads fullDistance, the tank is full (100%)
   
   // Check if the distance reading is within the expected range
-  if (currentDistance > emptyDistance) {
+  if (distance > emptyDistance) {
     // Reading is greater than max empty distance, cap at empty
     currentWaterLevel = 0;
     currentPercentage = 0;
     currentVolume = 0;
-  } else if (currentDistance < fullDistance) {
+  } else if (distance < fullDistance) {
     // Reading is less than min full distance, cap at full
     currentWaterLevel = tankHeight;
     currentPercentage = 100;
@@ -79,7 +82,7 @@ void calculateWaterLevel() {
     float distanceRange = emptyDistance - fullDistance;
     
     // Calculate percentage full (0-100%)
-    currentPercentage = ((emptyDistance - currentDistance) / distanceRange) * 100.0;
+    currentPercentage = ((emptyDistance - distance) / distanceRange) * 100.0;
     
     // Calculate water level (in cm)
     currentWaterLevel = (currentPercentage / 100.0) * tankHeight;
@@ -88,6 +91,13 @@ void calculateWaterLevel() {
     currentVolume = (currentPercentage / 100.0) * tankVolume;
   }
   
+  // Level and fill rate from the tracked distance rate (per minute, negative when draining)
+  if (emptyDistance > fullDistance) {
+    float fractionPerMinute = -distanceRate / (emptyDistance - fullDistance) * 60.0;
+    currentLevelRate = fractionPerMinute * tankHeight;
+    currentFillRate = fractionPerMinute * tankVolume;
+  }
+  
   // Round values for display
   currentPercentage = round(currentPercentage * 10) / 10.0; // One decimal place
   currentWaterLevel = round(currentWaterLevel * 10) / 10.0; // One decimal place
@@ -3,6 +3,10 @@
 #ifndef TANK_CALCULATOR_H
 #define TANK_CALCULATOR_H
 
+// Alert latches, set while an alert condition persists
+extern bool lowAlertActive;
+extern bool highAlertActive;
+
 /**
  * Initialize the tank calculator
  */
@@ -0,0 +1,77 @@
+#include <Arduino.h>
+#include "config.h"
+#include "temperature_manager.h"
+
+#ifdef TEMPERATURE_SENSOR_PIN
+#include <OneWire.h>
+#include <DallasTemperature.h>
+
+#define TEMPERATURE_CONVERSION_MS 750  // DS18B20 conversion time at 12 bits
+
+static OneWire oneWire(TEMPERATURE_SENSOR_PIN);
+static DallasTemperature temperatureSensor(&oneWire);
+static bool sensorFound = false;
+static bool conversionPending = false;
+static unsigned long conversionStart = 0;
+static unsigned long lastTemperatureRead = 0;
+#endif
+
+void setupTemperature() {
+  currentAirTemperature = airTemperature;
+  
+#ifdef TEMPERATURE_SENSOR_PIN
+  Serial.println("Initializing air temperature sensor...");
+  
+  temperatureSensor.begin();
+  sensorFound = temperatureSensor.getDeviceCount() > 0;
+  
+  if (sensorFound) {
+    // Conversions are started and collected from updateTemperature()
+    temperatureSensor.setWaitForConversion(false);
+    Serial.println("DS18B20 found on pin " + String(TEMPERATURE_SENSOR_PIN));
+    return;
+  }
+  
+  Serial.println("WARNING: No DS18B20 found, using configured temperature");
+#endif
+  
+  Serial.println("Air temperature: " + String(currentAirTemperature) + " C (configured)");
+}
+
+void updateTemperature() {
+#ifdef TEMPERATURE_SENSOR_PIN
+  if (sensorFound) {
+    unsigned long now = millis();
+    
+    if (!conversionPending) {
+      if (now - lastTemperatureRead >= TEMPERATURE_READ_INTERVAL * 1000UL || lastTemperatureRead == 0) {
+        temperatureSensor.requestTemperatures();
+        conversionStart = now;
+        conversionPending = true;
+      }
+    } else if (now - conversionStart >= TEMPERATURE_CONVERSION_MS) {
+      conversionPending = false;
+      lastTemperatureRead = now;
+      
+      float temperature = temperatureSensor.getTempCByIndex(0);
+      if (temperature != DEVICE_DISCONNECTED_C) {
+        currentAirTemperature = temperature;
+      } else {
+        Serial.println("WARNING: Temperature sensor read failed");
+      }
+    }
+    return;
+  }
+#endif
+  
+  // No sensor: follow the configured value
+  currentAirTemperature = airTemperature;
+}
+
+bool hasTemperatureSensor() {
+#ifdef TEMPERATURE_SENSOR_PIN
+  return sensorFound;
+#else
+  return false;
+#endif
+}
\ No newline at end of file
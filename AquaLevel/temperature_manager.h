@@ -0,0 +1,23 @@
+// temperature_manager.h
+#ifndef TEMPERATURE_MANAGER_H
+#define TEMPERATURE_MANAGER_H
+
+/**
+ * Initialize the air temperature source
+ * Uses a DS18B20 on TEMPERATURE_SENSOR_PIN when defined in config.h,
+ * otherwise the configured airTemperature setting
+ */
+void setupTemperature();
+
+/**
+ * Advance the temperature measurement without blocking
+ * Updates the global currentAirTemperature when a new value is available
+ */
+void updateTemperature();
+
+/**
+ * Check if the temperature comes from a sensor rather than the setting
+ */
+bool hasTemperatureSensor();
+
+#endif // TEMPERATURE_MANAGER_H
\ No newline at end of file
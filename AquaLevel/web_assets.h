@@ -0,0 +1,844 @@
+// web_assets.h
+// Generated by tools/build_web_assets.py from web/ - do not edit
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+struct WebAsset {
+  const char* path;
+  const char* contentType;
+  const uint8_t* data;         // Gzip compressed
+  size_t length;
+  const char* etag;
+  const char* cacheControl;
+};
+
+// /assets/index.913fc79973b7a09e.css: 7548 bytes, 2106 gzipped
+static const uint8_t INDEX_CSS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x58, 0x5b, 0x8f, 0xa3, 0xb8,
+  0x12, 0xfe, 0x2b, 0x68, 0xa3, 0xd6, 0x24, 0x7b, 0x42, 0x8b, 0x5b, 0xd2, 0xdd, 0xf0, 0x72, 0x66,
+  0x7b, 0x95, 0xa3, 0x7d, 0xde, 0x8b, 0xce, 0x79, 0x74, 0xc0, 0x49, 0x7c, 0x9a, 0x40, 0x64, 0x48,
+  0xd2, 0x3d, 0x28, 0xff, 0x7d, 0xab, 0x6c, 0x03, 0x36, 0x71, 0xd2, 0xcc, 0x68, 0x07, 0x4d, 0xd4,
+  0x18, 0xbb, 0x5c, 0xf5, 0xd5, 0xbd, 0x62, 0x5e, 0x96, 0x75, 0xe3, 0xba, 0x07, 0xce, 0xf6, 0x84,
+  0x7f, 0xc4, 0x93, 0xc0, 0x7f, 0x59, 0xae, 0xc2, 0xa4, 0x5b, 0x71, 0x73, 0xb6, 0xdd, 0xd5, 0xf1,
+  0x64, 0x19, 0xfd, 0xb2, 0x58, 0x2d, 0xb5, 0xf5, 0x8c, 0xf0, 0xb7, 0x78, 0xe2, 0xbf, 0x3c, 0x2d,
+  0x7f, 0x0d, 0x60, 0xb9, 0xa2, 0x69, 0x59, 0x64, 0x82, 0x84, 0x17, 0x7e, 0x7d, 0x59, 0x45, 0xb0,
+  0x46, 0xd2, 0x94, 0x16, 0x70, 0xd6, 0xf3, 0x7e, 0x79, 0xfd, 0x15, 0x17, 0xaa, 0x23, 0xac, 0x54,
+  0x55, 0x3c, 0x89, 0x5e, 0xbf, 0xae, 0x16, 0x1e, 0xac, 0x9c, 0x09, 0x2f, 0x58, 0xb1, 0x8d, 0x27,
+  0xab, 0xd5, 0xab, 0xef, 0x3d, 0xc1, 0x4a, 0x46, 0x8a, 0x2d, 0xe5, 0xb0, 0x10, 0x45, 0x61, 0x88,
+  0x17, 0xae, 0xb7, 0xed, 0x5d, 0x01, 0x3e, 0x72, 0x25, 0x25, 0x3c, 0x83, 0x15, 0x8a, 0x0f, 0xac,
+  0xd4, 0xf4, 0x1d, 0xee, 0xd9, 0x88, 0x7f, 0xea, 0x55, 0xe7, 0x68, 0xed, 0xe1, 0x83, 0x27, 0x4b,
+  0x9e, 0x51, 0xee, 0x72, 0x92, 0xb1, 0x63, 0x15, 0xfb, 0xc1, 0xe1, 0x1d, 0xb9, 0xda, 0x91, 0xac,
+  0x3c, 0xc7, 0x9e, 0xe3, 0x7b, 0x87, 0x77, 0x27, 0xc0, 0x1f, 0xbe, 0x5d, 0x93, 0xa9, 0x37, 0x17,
+  0xcf, 0x63, 0x38, 0x43, 0x92, 0x9c, 0x14, 0x15, 0xab, 0x59, 0x59, 0xc4, 0x24, 0xcf, 0x1d, 0x58,
+  0xad, 0x1c, 0x4a, 0x2a, 0x9a, 0x5c, 0x7e, 0x6e, 0x00, 0x8f, 0x2d, 0x2b, 0x62, 0x2f, 0x39, 0x90,
+  0x2c, 0x43, 0x69, 0xbc, 0x64, 0x5d, 0xbe, 0xbb, 0x15, 0xfb, 0x86, 0x2f, 0xea, 0x4e, 0x58, 0x49,
+  0x2e, 0xeb, 0x32, 0xfb, 0x68, 0x36, 0x65, 0x51, 0xbb, 0x1b, 0xb2, 0x67, 0xf9, 0x47, 0xfc, 0xe5,
+  0x77, 0xba, 0x2d, 0xa9, 0xf3, 0xe7, 0x6f, 0x5f, 0xe6, 0x7f, 0x90, 0x5d, 0xb9, 0x27, 0xf3, 0xff,
+  0xd0, 0x82, 0x9e, 0xc8, 0xfc, 0x2f, 0xca, 0x01, 0x09, 0x32, 0xaf, 0xe0, 0x5a, 0x10, 0x85, 0xb3,
+  0x4d, 0xb2, 0x26, 0xe9, 0xdb, 0x96, 0x97, 0xc7, 0x22, 0x73, 0xd3, 0x32, 0x2f, 0x79, 0x7c, 0x22,
+  0x7c, 0xda, 0xe1, 0x33, 0x4b, 0xf4, 0x45, 0x44, 0x60, 0x96, 0xec, 0x59, 0xe1, 0xee, 0xa8, 0x50,
+  0xa0, 0xef, 0x79, 0xa7, 0x5d, 0x92, 0xb1, 0xea, 0x90, 0x93, 0x8f, 0x78, 0x93, 0xd3, 0xf7, 0x04,
+  0x7f, 0xdc, 0x8c, 0x71, 0x9a, 0x0a, 0xb1, 0xe0, 0xf8, 0x71, 0x5f, 0x24, 0xff, 0x3f, 0x56, 0x35,
+  0xdb, 0x7c, 0xc0, 0x15, 0x45, 0x8d, 0xda, 0xab, 0x0e, 0x24, 0xa5, 0xee, 0x9a, 0xd6, 0x67, 0x4a,
+  0x8b, 0x4e, 0x42, 0x44, 0x49, 0x63, 0x28, 0xce, 0x59, 0x41, 0x09, 0x77, 0xb7, 0x88, 0x2c, 0x9c,
+  0x9a, 0xfa, 0xe1, 0x22, 0xa3, 0xdb, 0xb9, 0xd2, 0x99, 0xe3, 0x3d, 0xcc, 0x27, 0x01, 0xc1, 0x07,
+  0x40, 0xf6, 0x1e, 0x66, 0xc9, 0xe5, 0x71, 0x4f, 0x80, 0x39, 0x75, 0x49, 0x63, 0xf0, 0x35, 0xe4,
+  0x00, 0x8d, 0x88, 0xf2, 0x84, 0x80, 0x25, 0x16, 0x2e, 0xab, 0xe9, 0xbe, 0x6a, 0x97, 0x70, 0x7b,
+  0xec, 0x03, 0x31, 0xdc, 0x0a, 0xf4, 0x28, 0x6f, 0xce, 0x2c, 0xab, 0x77, 0x28, 0xed, 0x43, 0xb2,
+  0x27, 0xef, 0xae, 0x7c, 0x7d, 0xf1, 0x90, 0xdd, 0x11, 0xc2, 0x6f, 0xc9, 0x41, 0x8a, 0x06, 0x24,
+  0xc1, 0xc2, 0x1a, 0x4d, 0xc2, 0x0e, 0x6c, 0xfc, 0x30, 0x4b, 0x4c, 0x4b, 0x52, 0x1f, 0xf5, 0xb5,
+  0x99, 0xb4, 0x01, 0x69, 0x5b, 0xf2, 0xbb, 0x7c, 0x99, 0x25, 0xe5, 0x89, 0xf2, 0x4d, 0x0e, 0xcb,
+  0x3b, 0x96, 0x65, 0x08, 0x6a, 0xa9, 0x2c, 0x8b, 0xd3, 0x9c, 0xd4, 0xec, 0x44, 0xd5, 0xf5, 0xa0,
+  0x3b, 0x02, 0x04, 0x9b, 0xcf, 0x71, 0x96, 0xf4, 0x95, 0x6b, 0xce, 0x10, 0x6e, 0x63, 0x45, 0x3a,
+  0xf1, 0x4c, 0x61, 0x6f, 0xe8, 0x50, 0xb8, 0x8a, 0x80, 0xb6, 0x05, 0xf5, 0x13, 0x6e, 0x9c, 0x9d,
+  0x2f, 0x2d, 0x18, 0xcc, 0x9b, 0xc6, 0x41, 0x04, 0x34, 0xc4, 0xeb, 0x59, 0xda, 0xd9, 0xd2, 0xf3,
+  0x12, 0xe9, 0x0f, 0x00, 0x47, 0x5d, 0x97, 0xfb, 0xf8, 0xb9, 0xbd, 0xa5, 0xf3, 0x33, 0x70, 0x3b,
+  0x67, 0x31, 0xf4, 0xb2, 0x60, 0x36, 0xb8, 0xe7, 0xd0, 0x94, 0x60, 0x7a, 0xac, 0xfe, 0x88, 0xbd,
+  0xc7, 0x97, 0xa4, 0xbf, 0xd2, 0x8f, 0x84, 0x7e, 0xb6, 0x9c, 0x65, 0x9d, 0xdd, 0xe0, 0x4b, 0x82,
+  0x3f, 0x60, 0xf8, 0x7b, 0x58, 0xa9, 0xa9, 0x2b, 0x35, 0x0a, 0x4e, 0xbe, 0xe1, 0xbd, 0x5a, 0x0d,
+  0xd1, 0x2f, 0xff, 0xde, 0xd3, 0x8c, 0x11, 0x67, 0x8a, 0x6e, 0x22, 0x0d, 0xe5, 0x69, 0x09, 0xdc,
+  0xce, 0x1a, 0x49, 0xfc, 0x26, 0x3d, 0x07, 0x69, 0x5e, 0x2e, 0x8f, 0x35, 0x29, 0xde, 0xdc, 0xde,
+  0xf4, 0x46, 0xd8, 0x97, 0xc5, 0x86, 0x6f, 0x58, 0xbb, 0xa6, 0xf3, 0x89, 0x4f, 0xf0, 0x19, 0x63,
+  0x72, 0x86, 0x7c, 0x9a, 0xf7, 0x47, 0x9e, 0x34, 0x6a, 0xc1, 0xf1, 0x89, 0x55, 0x47, 0x60, 0xe4,
+  0x1b, 0x41, 0xce, 0x94, 0xc3, 0x04, 0x62, 0x83, 0xda, 0x1d, 0x8a, 0x97, 0x6b, 0x3b, 0x90, 0x97,
+  0xa1, 0x42, 0x9d, 0xaa, 0xcc, 0x59, 0xe6, 0x4c, 0xa2, 0x28, 0x6a, 0xd9, 0xaa, 0xcb, 0x43, 0x5c,
+  0x94, 0x45, 0xbb, 0x4b, 0x69, 0xdf, 0xcd, 0xe9, 0xa6, 0x6e, 0x59, 0x96, 0x41, 0xc3, 0xf8, 0xcc,
+  0xf1, 0x42, 0xe3, 0xfb, 0xd0, 0x39, 0x4c, 0x63, 0x1a, 0xc6, 0x9d, 0x6b, 0x13, 0xba, 0x16, 0x31,
+  0x8e, 0xd7, 0x74, 0x53, 0x72, 0xda, 0xb4, 0x10, 0x7f, 0xf9, 0xd2, 0x0b, 0x47, 0xd6, 0x20, 0xca,
+  0xb1, 0xa6, 0x09, 0xf2, 0xef, 0x62, 0x06, 0x48, 0x90, 0xe5, 0xd8, 0x45, 0xb3, 0x95, 0xd8, 0xa4,
+  0x24, 0x4f, 0xa7, 0xe8, 0x3a, 0xce, 0xbf, 0x1c, 0x7f, 0x09, 0xf6, 0x91, 0x74, 0x31, 0xd5, 0x64,
+  0x66, 0x00, 0x87, 0x21, 0xbb, 0xaf, 0xc9, 0x8e, 0xdf, 0x0c, 0xc1, 0x7d, 0xa9, 0x9d, 0x33, 0xd8,
+  0x19, 0x6f, 0xae, 0x59, 0x53, 0xb2, 0x7b, 0x92, 0x33, 0x2f, 0xd1, 0x62, 0xdc, 0xbd, 0xd0, 0xf0,
+  0xec, 0x5d, 0x85, 0x86, 0x36, 0x10, 0x5c, 0x05, 0x08, 0x91, 0x41, 0x54, 0x7c, 0xd0, 0x52, 0x9d,
+  0x14, 0xd4, 0xf1, 0x2b, 0x27, 0x3d, 0xae, 0x59, 0x0a, 0x69, 0xe0, 0x1b, 0xa3, 0x7c, 0x0a, 0x50,
+  0x87, 0x73, 0x1f, 0x53, 0x63, 0x30, 0xf7, 0x67, 0xb7, 0x44, 0x5e, 0xde, 0x91, 0x78, 0x69, 0xd1,
+  0xb4, 0x02, 0x20, 0x8e, 0xc9, 0x06, 0x71, 0xf8, 0x54, 0x5b, 0x03, 0x3c, 0x02, 0xc4, 0xe3, 0x86,
+  0x66, 0x84, 0x99, 0x04, 0x8b, 0xc5, 0xbc, 0xfd, 0x2f, 0xb2, 0xba, 0xe9, 0x50, 0x0b, 0x38, 0x4e,
+  0x0a, 0x80, 0x43, 0xdc, 0x74, 0x26, 0x27, 0xea, 0x40, 0x8e, 0x67, 0xc5, 0x86, 0x15, 0xe0, 0xb0,
+  0x8e, 0x84, 0x17, 0x82, 0xc6, 0x1b, 0xfd, 0xd8, 0x70, 0xb2, 0xa7, 0x95, 0x83, 0x7b, 0x1a, 0xef,
+  0xa1, 0x11, 0x80, 0x81, 0x85, 0xed, 0x63, 0xf1, 0x17, 0x86, 0x8b, 0xff, 0x4e, 0x5d, 0xa0, 0x37,
+  0x73, 0x2a, 0x30, 0x1e, 0x3a, 0x05, 0x8c, 0x2e, 0x8b, 0x5b, 0x1b, 0xb5, 0x6d, 0xc2, 0x82, 0x51,
+  0x09, 0xe3, 0x48, 0x5e, 0x1e, 0x73, 0x7a, 0xa2, 0xb9, 0x0b, 0x1a, 0x7c, 0xa3, 0xbc, 0xb2, 0x58,
+  0x8e, 0x34, 0xe5, 0x48, 0x04, 0x7a, 0x81, 0x58, 0x5f, 0x0d, 0x3c, 0x28, 0xd8, 0xc2, 0x91, 0xa9,
+  0x71, 0x5c, 0x5d, 0x20, 0x4a, 0x28, 0x2f, 0x31, 0x39, 0x33, 0x23, 0xa3, 0x2d, 0x8f, 0xf7, 0xc1,
+  0x1d, 0x4b, 0xb2, 0x61, 0x21, 0xd3, 0x97, 0x72, 0xb3, 0x01, 0x65, 0x9b, 0x6b, 0xb7, 0x97, 0xad,
+  0xf3, 0x32, 0x7d, 0xeb, 0x6c, 0xa3, 0x8f, 0x6e, 0xbe, 0x69, 0x1a, 0xf6, 0x6b, 0x54, 0xd4, 0x11,
+  0x36, 0x1b, 0x2f, 0x84, 0x77, 0x02, 0xea, 0xbc, 0x76, 0x59, 0x91, 0xb1, 0x94, 0xd4, 0xa5, 0xcd,
+  0x4f, 0x11, 0x62, 0xdc, 0x2b, 0x4f, 0xb9, 0xe1, 0x62, 0x7c, 0xd1, 0xa1, 0x22, 0x80, 0xbc, 0x43,
+  0xa1, 0xa6, 0xe9, 0xa7, 0x0d, 0xe3, 0x36, 0xd6, 0x65, 0xc1, 0x0c, 0x55, 0x45, 0x97, 0x2d, 0xa3,
+  0x01, 0xa5, 0xc7, 0x1d, 0x9c, 0x6e, 0x6e, 0x1e, 0x1c, 0x6c, 0x06, 0x8f, 0xbc, 0xde, 0xab, 0xea,
+  0xf4, 0xab, 0xcd, 0x24, 0xc5, 0xcc, 0xd0, 0x65, 0x6a, 0x5f, 0xf3, 0xa0, 0x35, 0x78, 0xcc, 0x1b,
+  0x86, 0x8e, 0xd6, 0x85, 0x0c, 0xdf, 0x11, 0x5f, 0xc1, 0x79, 0xe6, 0xc2, 0xdc, 0xfb, 0xf3, 0xc2,
+  0x4f, 0x7a, 0x51, 0x16, 0x5d, 0x9e, 0x05, 0x2a, 0xe5, 0x0f, 0xa6, 0x58, 0x0d, 0x60, 0xa4, 0xe2,
+  0x9e, 0x48, 0x7e, 0xa4, 0x5a, 0x11, 0x23, 0xfc, 0x43, 0x2f, 0x62, 0x9e, 0xa0, 0x88, 0xd1, 0x8d,
+  0xb0, 0x2d, 0xac, 0x06, 0x75, 0x8c, 0xea, 0x18, 0x44, 0x70, 0x09, 0x21, 0x20, 0x2e, 0xbc, 0x79,
+  0x10, 0x85, 0x10, 0x5b, 0xa2, 0x59, 0x7b, 0x55, 0x4e, 0xd6, 0x34, 0x6f, 0x06, 0xc5, 0xcb, 0x7d,
+  0xfb, 0xae, 0x6a, 0x52, 0x57, 0xee, 0xd8, 0xf2, 0x86, 0xd3, 0x03, 0x25, 0xf5, 0x14, 0xe2, 0xf0,
+  0x06, 0x54, 0x29, 0x24, 0x95, 0xe6, 0x8a, 0x64, 0xdc, 0x61, 0x11, 0xfb, 0x03, 0xa5, 0x84, 0x3f,
+  0xd2, 0x8a, 0x2d, 0xb8, 0x5f, 0xd7, 0x96, 0x8a, 0xad, 0xa1, 0x02, 0xee, 0x55, 0x91, 0xad, 0x53,
+  0x59, 0xf4, 0xa1, 0xb2, 0x59, 0x4b, 0xf5, 0x0a, 0xeb, 0xcf, 0x63, 0x09, 0x86, 0x0d, 0x5e, 0xe6,
+  0x55, 0x33, 0xd6, 0x4d, 0x25, 0xb6, 0xeb, 0x23, 0x24, 0xe4, 0xa2, 0xb1, 0x45, 0x1a, 0x11, 0x59,
+  0x0d, 0xec, 0xfe, 0xe1, 0xea, 0x5d, 0x0a, 0x74, 0xde, 0xb1, 0xba, 0x2b, 0xc8, 0xf4, 0xb2, 0xeb,
+  0x9e, 0x4a, 0x35, 0x68, 0x96, 0x16, 0xc0, 0xd3, 0x23, 0xaf, 0x80, 0xf4, 0xa1, 0x64, 0x52, 0x7b,
+  0x7d, 0x19, 0xa0, 0xe0, 0xeb, 0x16, 0x94, 0x23, 0xf4, 0x49, 0xea, 0x78, 0x38, 0x50, 0x9e, 0x62,
+  0x3b, 0x9c, 0xd3, 0x1a, 0x0e, 0xbb, 0x98, 0x1d, 0x04, 0x02, 0xd6, 0x16, 0x43, 0xac, 0x64, 0xa0,
+  0x08, 0x2e, 0x43, 0x85, 0x10, 0xa0, 0x85, 0x35, 0xde, 0x61, 0x61, 0x60, 0xcb, 0x80, 0xff, 0x9b,
+  0xba, 0x21, 0x96, 0x5f, 0x5a, 0x63, 0xe5, 0x39, 0xcf, 0x46, 0xcf, 0x7e, 0xed, 0x86, 0x92, 0x68,
+  0xaf, 0xf6, 0xd1, 0xdd, 0x54, 0x6f, 0x28, 0xbd, 0x46, 0xe4, 0x44, 0x63, 0xd6, 0x35, 0xb1, 0x8a,
+  0xb8, 0x8c, 0xa4, 0xa3, 0x29, 0xab, 0xc0, 0x2b, 0xba, 0xe2, 0xd5, 0xea, 0xc9, 0x8b, 0xc2, 0x21,
+  0x41, 0x35, 0x28, 0x19, 0xcf, 0xab, 0xdc, 0x2f, 0x49, 0x3e, 0xfb, 0xaf, 0x4f, 0xcf, 0xd1, 0x90,
+  0xa4, 0x8a, 0xe0, 0xa3, 0x49, 0xb6, 0x11, 0x5f, 0x71, 0xf9, 0xfa, 0x35, 0x78, 0xee, 0x48, 0x42,
+  0x05, 0xc2, 0xd6, 0x52, 0x77, 0x32, 0xc4, 0x68, 0xbe, 0xda, 0xb5, 0xcf, 0xfd, 0x96, 0x9a, 0xd5,
+  0xb9, 0xee, 0xee, 0x56, 0xeb, 0x33, 0xeb, 0x7c, 0xdf, 0xde, 0x9b, 0x9a, 0x74, 0xa5, 0x64, 0x03,
+  0xe7, 0xd5, 0x82, 0x7d, 0x5e, 0x12, 0x74, 0x43, 0x17, 0xed, 0x09, 0xbe, 0xf7, 0x19, 0x7b, 0xc3,
+  0xde, 0x69, 0x66, 0xd6, 0x90, 0x32, 0x67, 0x7b, 0x7d, 0xad, 0x7d, 0xab, 0xc9, 0x78, 0x9a, 0x25,
+  0x3f, 0x38, 0xad, 0xf8, 0x86, 0xc5, 0x03, 0x0e, 0x2c, 0x3c, 0x0f, 0x2b, 0xa4, 0xea, 0xc0, 0x8a,
+  0x7e, 0x62, 0xb1, 0xd0, 0xd2, 0xfc, 0xa2, 0xef, 0x15, 0x30, 0xf4, 0xa9, 0x66, 0xcb, 0x52, 0xc3,
+  0xfa, 0xb6, 0x1a, 0x56, 0x2b, 0xb9, 0xad, 0x39, 0xac, 0xcf, 0xd0, 0xc8, 0x01, 0x26, 0x68, 0x69,
+  0x07, 0xf6, 0x3c, 0x8d, 0x7b, 0x9a, 0xba, 0xd4, 0xdc, 0x91, 0x97, 0x10, 0x6c, 0xe9, 0x34, 0x5c,
+  0x62, 0x7b, 0x21, 0xaa, 0xd0, 0xa2, 0x04, 0x04, 0xb0, 0x2a, 0xc2, 0x7e, 0xd2, 0x02, 0xb2, 0x30,
+  0x09, 0x09, 0xb0, 0xd1, 0x85, 0x63, 0x78, 0x74, 0x82, 0xef, 0x89, 0x91, 0xb7, 0xed, 0xfc, 0x3a,
+  0x2c, 0xde, 0x0d, 0x85, 0xd6, 0xfa, 0x5a, 0x6f, 0xf4, 0x90, 0xd1, 0x99, 0xd1, 0x0b, 0x75, 0x47,
+  0xb4, 0xe1, 0x9f, 0x11, 0x89, 0x50, 0x1a, 0xdf, 0x36, 0xd7, 0x18, 0x28, 0x5e, 0x87, 0xeb, 0x91,
+  0x72, 0x5e, 0xfe, 0x23, 0x91, 0xc3, 0xa0, 0x5a, 0xed, 0xa0, 0x88, 0xb3, 0x77, 0x1b, 0xb8, 0x77,
+  0x53, 0x96, 0xd8, 0x61, 0x59, 0x66, 0x3f, 0xba, 0x66, 0x8c, 0x14, 0x1c, 0x76, 0x35, 0xd2, 0xb8,
+  0xdc, 0xaa, 0x65, 0x43, 0x2c, 0xe0, 0xd6, 0xb7, 0xe6, 0x24, 0xb6, 0xf6, 0x5e, 0x9f, 0x10, 0x60,
+  0x06, 0x69, 0xa7, 0x0d, 0x61, 0x18, 0x4a, 0x62, 0x8d, 0xd1, 0x6e, 0x88, 0x2c, 0x3b, 0x48, 0x5e,
+  0x57, 0xb3, 0x52, 0x01, 0xc1, 0x81, 0x70, 0x90, 0xd3, 0x48, 0x9b, 0xf7, 0x64, 0x18, 0x94, 0x6d,
+  0xb6, 0xc1, 0x18, 0x30, 0xd3, 0xd6, 0xc0, 0x56, 0x67, 0xd3, 0x77, 0x8c, 0x6a, 0x6c, 0x95, 0xd4,
+  0xae, 0xdf, 0x0e, 0x22, 0x8c, 0x76, 0x5f, 0x05, 0x88, 0xc0, 0x70, 0x19, 0xf7, 0xc6, 0xcd, 0xa8,
+  0x7a, 0x97, 0x83, 0x21, 0x58, 0x30, 0x56, 0x5f, 0x65, 0xc9, 0x64, 0xd6, 0x31, 0xd7, 0xd3, 0xbb,
+  0xef, 0x2a, 0x5f, 0x05, 0x5d, 0x56, 0x1c, 0x8e, 0x75, 0x63, 0xab, 0x88, 0x82, 0xc1, 0xc8, 0x44,
+  0x4e, 0x85, 0x5b, 0x95, 0xf8, 0xd6, 0xd1, 0xd2, 0x3d, 0x47, 0xbe, 0x1e, 0x7a, 0x0f, 0xf2, 0x0c,
+  0x16, 0xe2, 0xc0, 0x8c, 0x8b, 0x17, 0x1e, 0x3e, 0xed, 0x44, 0x8d, 0xdd, 0x8e, 0x2e, 0x8c, 0x9a,
+  0x35, 0xdf, 0x1a, 0x68, 0x78, 0xf7, 0x06, 0x5b, 0x9e, 0x49, 0xd7, 0x25, 0x50, 0x2e, 0x15, 0x66,
+  0x61, 0x8e, 0xe2, 0xea, 0x20, 0x49, 0xab, 0xbe, 0x75, 0xdb, 0x8d, 0x79, 0xf3, 0x4d, 0x06, 0x46,
+  0x41, 0x67, 0xea, 0xb1, 0x2e, 0xb7, 0xdb, 0x9c, 0xba, 0xd5, 0x99, 0xd5, 0xe9, 0xae, 0xb9, 0xb6,
+  0xfd, 0x16, 0x49, 0x56, 0x60, 0xc4, 0x72, 0xf5, 0x1a, 0x78, 0xa9, 0xcf, 0x12, 0xe5, 0xb4, 0xd6,
+  0xa0, 0xe6, 0x48, 0x44, 0xbb, 0x2e, 0x4f, 0x1d, 0xeb, 0xa6, 0x13, 0x9e, 0x76, 0x00, 0x6c, 0xc1,
+  0x3a, 0x13, 0x1b, 0x16, 0xab, 0x23, 0x73, 0xb9, 0xf2, 0x15, 0x11, 0x4a, 0xb4, 0xd8, 0xfe, 0x18,
+  0x55, 0x03, 0x63, 0x1b, 0xf0, 0x2d, 0xd8, 0x68, 0x87, 0x0d, 0x16, 0x6e, 0x94, 0x4b, 0xff, 0xf4,
+  0x53, 0xe7, 0xa2, 0xcb, 0x6e, 0x7e, 0x28, 0xfe, 0x14, 0xac, 0x89, 0xfe, 0x5d, 0x32, 0x15, 0xd9,
+  0x5c, 0x58, 0xa6, 0xaf, 0xbb, 0x7c, 0x61, 0x86, 0xbf, 0x08, 0xfc, 0xe2, 0x74, 0x47, 0xd3, 0x37,
+  0x9a, 0x41, 0xb2, 0x1a, 0xa0, 0xf5, 0x69, 0x68, 0xb8, 0x7f, 0xbe, 0x15, 0xd3, 0x9a, 0x3f, 0x02,
+  0x31, 0x00, 0xed, 0x80, 0xb9, 0x11, 0xd5, 0xef, 0x0f, 0x8b, 0x2c, 0x7e, 0x67, 0x0d, 0x51, 0xea,
+  0x8e, 0xef, 0xef, 0xa1, 0x27, 0x38, 0x31, 0xf8, 0x1d, 0x3a, 0x11, 0xf0, 0xa6, 0x6a, 0x05, 0x12,
+  0xcc, 0x27, 0x62, 0x6a, 0x61, 0x2e, 0x15, 0xc0, 0x4e, 0xc9, 0x8d, 0x7d, 0x9d, 0x14, 0xb2, 0x23,
+  0xb9, 0xa2, 0xa3, 0x22, 0xb9, 0x85, 0x5c, 0xf7, 0xc5, 0x42, 0xb5, 0xcd, 0x10, 0x66, 0x9c, 0xbd,
+  0xfc, 0x0d, 0xc7, 0x50, 0xb1, 0xe8, 0x7c, 0x1d, 0x00, 0x00
+};
+
+// /assets/index.eba0cf7099ff4615.js: 3654 bytes, 1001 gzipped
+static const uint8_t INDEX_JS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x57, 0x5d, 0x6f, 0xd3, 0x30,
+  0x14, 0x7d, 0xcf, 0xaf, 0x30, 0x48, 0x28, 0xa9, 0x28, 0xd9, 0x06, 0x6f, 0x2b, 0x1b, 0xe2, 0xa3,
+  0x13, 0x43, 0x63, 0x20, 0xbe, 0xde, 0x4d, 0x72, 0xb3, 0x9a, 0xb9, 0x76, 0x64, 0xbb, 0xed, 0x2a,
+  0xb4, 0xff, 0xce, 0xb5, 0xf3, 0x65, 0xa7, 0x69, 0x56, 0xc4, 0x1b, 0xda, 0x4b, 0xea, 0x9c, 0x73,
+  0x7c, 0x7d, 0xee, 0xf5, 0xbd, 0x59, 0x26, 0x85, 0x36, 0x64, 0x43, 0x0d, 0xa8, 0x39, 0x27, 0x67,
+  0x24, 0x97, 0xd9, 0x6a, 0x09, 0xc2, 0xa4, 0x37, 0x60, 0xe6, 0x1c, 0xec, 0xe3, 0x9b, 0xed, 0x65,
+  0x9e, 0xc4, 0x0e, 0x12, 0x4f, 0x66, 0x51, 0xe6, 0x18, 0x25, 0xa8, 0x0c, 0xdf, 0xd1, 0x1b, 0x78,
+  0xc7, 0x74, 0xc9, 0xe9, 0x76, 0x8c, 0xbb, 0x03, 0xee, 0x74, 0xd6, 0x92, 0x23, 0xe7, 0x00, 0x8d,
+  0x00, 0xd8, 0xf1, 0x33, 0x5a, 0xd2, 0x8c, 0x99, 0xed, 0x01, 0x0a, 0x3d, 0x68, 0xa7, 0xc1, 0x61,
+  0x0d, 0xfc, 0x00, 0x01, 0x1f, 0xd7, 0xb1, 0x73, 0xa6, 0x0d, 0x15, 0xd9, 0x21, 0x67, 0xe8, 0x41,
+  0x3b, 0x8d, 0x82, 0x71, 0xfe, 0x05, 0x0d, 0x3e, 0x40, 0xa3, 0x07, 0xed, 0x34, 0x16, 0xec, 0x66,
+  0xf1, 0x9a, 0x83, 0x32, 0x63, 0xec, 0x16, 0xe4, 0x9d, 0x5e, 0x6e, 0x1e, 0xa4, 0x35, 0x18, 0x9f,
+  0x45, 0x73, 0x26, 0x6e, 0x3e, 0xad, 0x41, 0x3d, 0xe4, 0x5a, 0x80, 0xec, 0x14, 0x84, 0x34, 0xac,
+  0x60, 0x19, 0x35, 0x4c, 0x8a, 0x31, 0xbe, 0x8f, 0xf3, 0xf3, 0xce, 0xd9, 0x4f, 0x85, 0x3e, 0xcc,
+  0x97, 0xa5, 0xd9, 0xbe, 0x31, 0x62, 0x3c, 0xf3, 0x3d, 0xf0, 0x80, 0xce, 0xc5, 0x8a, 0xf3, 0x43,
+  0x65, 0x6a, 0xac, 0x55, 0xe1, 0x60, 0x08, 0xe6, 0xf4, 0xf6, 0x1d, 0x35, 0x14, 0xb9, 0xbf, 0xa3,
+  0xae, 0xd6, 0x4f, 0xc9, 0xf1, 0x34, 0xaa, 0xca, 0xd6, 0x3d, 0xba, 0x1b, 0x74, 0x65, 0x6b, 0xc8,
+  0xfd, 0x6c, 0x8a, 0xc1, 0xfd, 0x68, 0xb2, 0xea, 0x7e, 0x58, 0xbd, 0x1f, 0x1d, 0x8f, 0x5a, 0xe7,
+  0x1d, 0xef, 0x4a, 0x6e, 0x7a, 0x2b, 0xef, 0x31, 0x9f, 0xdd, 0x92, 0x9e, 0x0b, 0xfa, 0x93, 0x43,
+  0x7e, 0x4a, 0x8c, 0x5a, 0x41, 0x74, 0x3f, 0x8b, 0x36, 0x4c, 0xe4, 0x72, 0x93, 0xd2, 0x3c, 0x9f,
+  0xaf, 0x31, 0xaa, 0x2b, 0xdc, 0x13, 0x04, 0xa8, 0x2a, 0x2b, 0xf1, 0x94, 0x14, 0x2b, 0x91, 0x59,
+  0x63, 0x93, 0x09, 0x86, 0x5e, 0x80, 0xc9, 0x16, 0xdf, 0xea, 0xc3, 0x24, 0x78, 0x38, 0x0d, 0xe6,
+  0x1b, 0x5b, 0x82, 0x5c, 0x99, 0x24, 0x00, 0x86, 0x29, 0x4d, 0xb5, 0xd9, 0x72, 0x48, 0xf3, 0xb6,
+  0x76, 0x31, 0x65, 0x02, 0xe2, 0x59, 0x74, 0x3f, 0x25, 0x27, 0xc7, 0xc7, 0xc7, 0x28, 0x74, 0x5f,
+  0x3b, 0x55, 0x4a, 0xce, 0xad, 0xa2, 0x42, 0x94, 0x40, 0x13, 0x67, 0x51, 0xa3, 0x4b, 0xd0, 0x0c,
+  0x65, 0x3e, 0xe3, 0x7b, 0x14, 0x76, 0x9b, 0xb0, 0x82, 0x24, 0x8f, 0x5a, 0x82, 0x5d, 0xf1, 0xd9,
+  0x18, 0xda, 0xa5, 0x40, 0x3f, 0xd7, 0x94, 0x27, 0x41, 0xdc, 0x53, 0xf2, 0xbc, 0xde, 0x13, 0xff,
+  0x3c, 0x75, 0x59, 0xf6, 0xc5, 0x03, 0xed, 0x8c, 0x03, 0x55, 0xad, 0x62, 0xf7, 0x6a, 0x16, 0xed,
+  0xc6, 0x6c, 0x95, 0xad, 0x40, 0x6d, 0xae, 0x73, 0xf6, 0xab, 0x5c, 0x61, 0xde, 0x9d, 0x92, 0xab,
+  0x2b, 0xb0, 0x8b, 0xda, 0x52, 0x60, 0x43, 0x3c, 0x44, 0x12, 0x1f, 0x55, 0xaf, 0x6c, 0xf1, 0x54,
+  0x4f, 0x03, 0xd9, 0xb1, 0x15, 0xe0, 0x67, 0xc7, 0x09, 0x7b, 0x65, 0xf6, 0xe1, 0xeb, 0xa7, 0xeb,
+  0xb4, 0xa4, 0x4a, 0x43, 0x82, 0xc6, 0xe3, 0x1a, 0x8a, 0xad, 0x4a, 0x7c, 0x80, 0xef, 0x97, 0x49,
+  0xed, 0x77, 0x2d, 0x2e, 0x85, 0x2c, 0xc1, 0x96, 0xb5, 0x67, 0x81, 0xf7, 0x12, 0x94, 0x92, 0xce,
+  0x4f, 0xcf, 0x7e, 0xe4, 0x13, 0xe0, 0x1a, 0x70, 0xcf, 0x30, 0x2b, 0x33, 0xdf, 0xd2, 0x5e, 0xb5,
+  0x34, 0xf5, 0x83, 0x07, 0xb4, 0x81, 0x3e, 0xb3, 0x51, 0xc5, 0x93, 0x28, 0x35, 0x0b, 0x10, 0x89,
+  0x02, 0x5d, 0xa2, 0x2d, 0x40, 0xce, 0xce, 0x49, 0xf3, 0x9c, 0xfe, 0xd2, 0xb6, 0x9c, 0x1a, 0x48,
+  0xee, 0x4e, 0x76, 0x1e, 0x9e, 0xd3, 0x2e, 0xf6, 0x4f, 0x16, 0xa5, 0xd8, 0x0b, 0x70, 0x9f, 0x3a,
+  0xf2, 0xf3, 0xda, 0x72, 0x89, 0x25, 0xe8, 0x96, 0x92, 0x78, 0xee, 0xde, 0xb8, 0x68, 0x30, 0x6c,
+  0x77, 0x3d, 0x9d, 0xd2, 0x29, 0x5a, 0xea, 0x20, 0xb5, 0x43, 0xde, 0x61, 0xba, 0x2d, 0x50, 0xae,
+  0x9e, 0x86, 0x75, 0x5d, 0x2f, 0x00, 0xef, 0x98, 0xed, 0x8e, 0x4d, 0x5c, 0x69, 0x77, 0xc5, 0xc9,
+  0x53, 0x12, 0x3f, 0xc1, 0x4a, 0xdf, 0x19, 0x70, 0xa9, 0x81, 0x3b, 0xf3, 0x56, 0x62, 0x3d, 0x89,
+  0x3d, 0xd4, 0xd4, 0xc8, 0x0b, 0x76, 0x07, 0x79, 0x72, 0x32, 0x69, 0x54, 0x82, 0x11, 0xb7, 0x4f,
+  0xa1, 0x02, 0x79, 0x6c, 0xec, 0x64, 0xe1, 0x60, 0xdb, 0xc7, 0xec, 0xda, 0x4a, 0xc0, 0xf6, 0xa7,
+  0xda, 0x3e, 0x6a, 0xd7, 0xba, 0x02, 0x6a, 0x6f, 0x9e, 0xed, 0x63, 0x37, 0xb0, 0x80, 0xdb, 0x9b,
+  0x63, 0xfb, 0xb8, 0x0d, 0x2c, 0xe0, 0xda, 0xcb, 0xd7, 0x22, 0x82, 0xce, 0xd7, 0xdc, 0xed, 0xa1,
+  0x5c, 0x9d, 0x7b, 0xb2, 0x61, 0x07, 0xb5, 0xac, 0x76, 0x32, 0xa6, 0x19, 0xa7, 0x5a, 0xdb, 0xbb,
+  0x68, 0x2f, 0x66, 0x12, 0x53, 0xac, 0x90, 0x35, 0xd8, 0xeb, 0xda, 0xde, 0x8a, 0x21, 0xac, 0x82,
+  0xa5, 0x5c, 0x43, 0x00, 0xdf, 0x1b, 0xc9, 0xcb, 0xc1, 0x48, 0xb0, 0xbb, 0x57, 0xcd, 0x75, 0x73,
+  0x68, 0x1c, 0x03, 0xd0, 0xa1, 0x30, 0xfe, 0x32, 0xee, 0x43, 0x55, 0xbd, 0xee, 0xba, 0x90, 0x9b,
+  0x6b, 0x6f, 0x4c, 0x27, 0x4b, 0xd0, 0x1a, 0x0f, 0x3a, 0x25, 0x4c, 0xcf, 0xeb, 0x06, 0x53, 0x50,
+  0x8c, 0xc1, 0x9e, 0xcf, 0x9f, 0xe7, 0xbd, 0xac, 0xd7, 0xb4, 0x2a, 0xc1, 0x35, 0x75, 0x87, 0xd2,
+  0xb3, 0xc5, 0x5d, 0xe8, 0xc0, 0x95, 0x3d, 0xe8, 0xe6, 0x0c, 0x1d, 0x61, 0x54, 0xd7, 0x9e, 0x29,
+  0x1e, 0x99, 0x81, 0x0f, 0xec, 0xd2, 0xd0, 0x71, 0x06, 0xbe, 0x68, 0xe6, 0xd1, 0xce, 0x67, 0xc8,
+  0x40, 0xe7, 0xcf, 0x38, 0xcb, 0x6e, 0xfb, 0x83, 0xd9, 0xda, 0x81, 0x3d, 0xae, 0x60, 0x6a, 0x99,
+  0xc4, 0x6f, 0x1b, 0x15, 0x02, 0x56, 0xc6, 0x55, 0xd2, 0x2b, 0xf2, 0x91, 0xde, 0x02, 0xd1, 0x2b,
+  0x05, 0x04, 0xbb, 0x69, 0xd5, 0xf2, 0x98, 0xae, 0x10, 0x69, 0x3c, 0xf1, 0xbb, 0x73, 0x1b, 0xc5,
+  0x2b, 0xb3, 0x2d, 0xe1, 0xcc, 0x41, 0xc6, 0x1b, 0xb5, 0x4d, 0xd2, 0x50, 0xa3, 0xde, 0x49, 0x7b,
+  0x3d, 0x89, 0xfa, 0xdf, 0x11, 0xe4, 0xe8, 0x88, 0x7c, 0x81, 0x02, 0xf5, 0x16, 0xae, 0x0f, 0x0f,
+  0x37, 0xf1, 0x1d, 0xb5, 0xf6, 0xa4, 0x6e, 0xda, 0x50, 0xe6, 0x3e, 0x6c, 0x62, 0x6c, 0x96, 0x8e,
+  0x34, 0x75, 0xdf, 0x38, 0x6d, 0x27, 0xbf, 0x77, 0x7d, 0x30, 0xfc, 0x3e, 0xfb, 0x47, 0x7b, 0x0b,
+  0x54, 0x19, 0x75, 0xd7, 0xf6, 0x26, 0xc8, 0x89, 0x91, 0x64, 0x8b, 0xb3, 0x9d, 0xe4, 0xa0, 0x99,
+  0xc2, 0xdf, 0x8f, 0x2d, 0xf1, 0x71, 0xf5, 0x5f, 0xc5, 0xb8, 0xf7, 0x16, 0xf8, 0x5f, 0x58, 0xff,
+  0x07, 0x2b, 0xb9, 0x73, 0xe0, 0x46, 0x0e, 0x00, 0x00
+};
+
+// /: 2756 bytes, 855 gzipped
+static const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x56, 0x5b, 0x6f, 0xd3, 0x30,
+  0x14, 0x7e, 0xdf, 0xaf, 0x30, 0x91, 0xd0, 0x1e, 0x20, 0x4d, 0xcb, 0x18, 0x55, 0xa1, 0x89, 0x04,
+  0x63, 0x88, 0x07, 0xae, 0x1b, 0x17, 0xf1, 0xe8, 0x3a, 0x27, 0xad, 0x99, 0x63, 0x07, 0xfb, 0x24,
+  0xa5, 0x88, 0x1f, 0x8f, 0x2f, 0x29, 0xcb, 0x42, 0xba, 0x16, 0x21, 0xf1, 0xe4, 0xe4, 0x5c, 0x3e,
+  0x7f, 0x3e, 0x17, 0xfb, 0xcc, 0xef, 0x3c, 0x7f, 0x7b, 0xf6, 0xe1, 0xcb, 0xbb, 0x73, 0xb2, 0xc2,
+  0x52, 0x64, 0x47, 0x73, 0xb7, 0x10, 0x41, 0xe5, 0x32, 0x8d, 0x40, 0x46, 0x4e, 0x00, 0x34, 0xb7,
+  0x0b, 0x72, 0x14, 0x90, 0x3d, 0xfd, 0x56, 0xd3, 0x57, 0xd0, 0x80, 0x20, 0xcd, 0x64, 0x34, 0x9e,
+  0x27, 0x41, 0x7a, 0x34, 0x2f, 0x01, 0x29, 0x91, 0xb4, 0x84, 0xf4, 0xb8, 0xe1, 0xb0, 0xae, 0x94,
+  0xc6, 0x63, 0xc2, 0x94, 0x44, 0x90, 0x98, 0x1e, 0xaf, 0x79, 0x8e, 0xab, 0x34, 0x87, 0x86, 0x33,
+  0x88, 0xfd, 0xcf, 0x7d, 0xc2, 0x25, 0x47, 0x4e, 0x45, 0x6c, 0x18, 0x15, 0x90, 0x4e, 0x8e, 0x2d,
+  0x88, 0xe0, 0xf2, 0x8a, 0x68, 0x10, 0x69, 0x64, 0x70, 0x23, 0xc0, 0xac, 0x00, 0x30, 0x22, 0x2b,
+  0x0d, 0x45, 0x1a, 0x25, 0xd4, 0x18, 0x40, 0x93, 0x70, 0x99, 0xc3, 0xf7, 0xd1, 0x6c, 0x72, 0x52,
+  0xb0, 0xe9, 0x6c, 0x36, 0x3d, 0x59, 0x4c, 0xe9, 0x78, 0x06, 0x23, 0x66, 0x8c, 0xe3, 0x9a, 0xb4,
+  0x64, 0x17, 0x2a, 0xdf, 0xd8, 0x25, 0xe7, 0x0d, 0x61, 0xc2, 0x7a, 0xa6, 0x91, 0x50, 0x34, 0xe7,
+  0x72, 0x19, 0xab, 0x06, 0xb4, 0xa0, 0x9b, 0x88, 0xf0, 0xfc, 0xb7, 0xf0, 0x6d, 0x2b, 0xbb, 0xe9,
+  0x61, 0x2a, 0x2e, 0x25, 0xe8, 0x28, 0x9b, 0x27, 0x56, 0xea, 0xc0, 0xc3, 0xd2, 0x31, 0x91, 0x0a,
+  0x79, 0xc1, 0x19, 0x45, 0xae, 0x64, 0x40, 0xbc, 0x21, 0xc9, 0x8e, 0x2e, 0x01, 0xd1, 0x6e, 0x60,
+  0x88, 0xa1, 0x0d, 0xe4, 0xc4, 0xd4, 0x8c, 0x81, 0x31, 0x45, 0x2d, 0xc4, 0xe6, 0xce, 0x10, 0x60,
+  0x49, 0xb9, 0x8c, 0xdb, 0xb0, 0xf5, 0xe8, 0x38, 0xa9, 0xd5, 0x3a, 0x42, 0x37, 0xe5, 0x54, 0xe7,
+  0x03, 0xa2, 0xd8, 0x45, 0x22, 0x18, 0xaf, 0x26, 0x9d, 0xb4, 0xbd, 0x56, 0x36, 0xee, 0x4a, 0xdb,
+  0x48, 0x4d, 0xac, 0xaa, 0xca, 0x2e, 0xc0, 0xe6, 0x00, 0x79, 0x09, 0x64, 0x4d, 0x11, 0x34, 0x11,
+  0xde, 0xaa, 0x0c, 0x56, 0x96, 0x3a, 0x31, 0x1b, 0x83, 0x50, 0xce, 0x93, 0x6a, 0x30, 0x02, 0x4b,
+  0xcd, 0xfb, 0xbb, 0x23, 0x95, 0x57, 0xf1, 0x2e, 0xb6, 0x5e, 0xd9, 0x70, 0x53, 0x53, 0xc1, 0x7f,
+  0x6c, 0xa3, 0xd4, 0x35, 0xf0, 0x2c, 0x42, 0x2c, 0xdb, 0x4f, 0x5f, 0x0b, 0x69, 0xb4, 0x02, 0xbe,
+  0x5c, 0xe1, 0x63, 0x32, 0xbe, 0xfb, 0xe4, 0x3a, 0x25, 0xdd, 0x04, 0x3b, 0xe2, 0x71, 0x49, 0xf5,
+  0x15, 0x68, 0x13, 0xed, 0xd6, 0x45, 0xd9, 0x64, 0x3c, 0xbe, 0xbb, 0x07, 0x20, 0xca, 0xa6, 0xa7,
+  0xfb, 0x6d, 0x4e, 0x0f, 0xc0, 0x79, 0x70, 0x00, 0xce, 0x35, 0xcc, 0x9f, 0x96, 0xb6, 0x39, 0x34,
+  0xc6, 0xb6, 0xea, 0x5d, 0x51, 0xa9, 0x7e, 0x38, 0x83, 0x36, 0xe0, 0x90, 0x95, 0x0d, 0x50, 0x88,
+  0x9c, 0xfb, 0x7a, 0xea, 0x54, 0x83, 0x91, 0xba, 0xe1, 0x24, 0xd4, 0x7a, 0xdb, 0x0b, 0xeb, 0x9e,
+  0xcb, 0x4e, 0x4e, 0x3e, 0x89, 0x5c, 0x16, 0xaa, 0xc7, 0xc6, 0x89, 0xe2, 0x86, 0x8a, 0x1a, 0x02,
+  0x64, 0x05, 0x9a, 0xd9, 0x42, 0xa6, 0x4b, 0x78, 0xce, 0x4d, 0xe5, 0x3b, 0x2c, 0x8e, 0x47, 0xf1,
+  0x00, 0xa2, 0xf7, 0x14, 0x74, 0x01, 0x22, 0xca, 0x3e, 0xfb, 0x3a, 0xf4, 0xd5, 0xba, 0x97, 0x89,
+  0x41, 0x8a, 0x66, 0x67, 0xb1, 0x05, 0xed, 0x40, 0x89, 0x3a, 0x45, 0x3c, 0xd0, 0x38, 0x5e, 0xde,
+  0xd2, 0x38, 0xab, 0xb5, 0xb6, 0xe4, 0xc9, 0x27, 0x25, 0xea, 0x12, 0x76, 0xec, 0xdd, 0x3d, 0x6d,
+  0xe3, 0x0d, 0xf7, 0x9d, 0xb4, 0xbb, 0x85, 0xe0, 0xf6, 0xa4, 0xe6, 0xf6, 0xd3, 0xed, 0xa3, 0xf9,
+  0xc1, 0xe6, 0x82, 0x9c, 0xd1, 0x8a, 0x32, 0x8e, 0x9b, 0x03, 0x58, 0xb2, 0xd6, 0xf4, 0x7f, 0xf3,
+  0x1c, 0xc8, 0xea, 0x2d, 0x2c, 0x7d, 0x7f, 0xfc, 0x0d, 0x45, 0x56, 0xfe, 0x1b, 0xbd, 0xd7, 0x40,
+  0x4d, 0xad, 0xed, 0x15, 0x6d, 0x37, 0xb5, 0xe5, 0xcd, 0x0e, 0x49, 0x78, 0xde, 0x9a, 0xfe, 0x4f,
+  0x9e, 0x2f, 0xb8, 0x10, 0xe4, 0xc2, 0xc6, 0xf2, 0x00, 0x7e, 0x85, 0xb5, 0x75, 0xa6, 0x7f, 0x9f,
+  0xea, 0xa4, 0xe4, 0x72, 0x6f, 0xef, 0xb9, 0xae, 0xd3, 0x4a, 0xf8, 0xbb, 0x96, 0x6e, 0x5f, 0x69,
+  0xd3, 0x3e, 0x78, 0x23, 0x37, 0x46, 0x44, 0x5b, 0xd3, 0x45, 0x8d, 0xe8, 0x6e, 0x7a, 0x5f, 0xac,
+  0xdb, 0x37, 0x71, 0x9e, 0xd0, 0xae, 0xa7, 0x04, 0x5c, 0x2b, 0x7d, 0xd5, 0xf3, 0x21, 0x61, 0x89,
+  0x0d, 0xd8, 0xed, 0x72, 0xaa, 0xed, 0x29, 0xde, 0x04, 0xc3, 0x1e, 0xce, 0x00, 0x3f, 0xfb, 0xc4,
+  0x2c, 0xb4, 0x7f, 0x63, 0xe2, 0xc1, 0x47, 0xf2, 0x5a, 0xed, 0xa7, 0x98, 0x28, 0x7b, 0x5f, 0x73,
+  0xe6, 0x9a, 0xe9, 0xb7, 0x62, 0x0f, 0x6a, 0xe0, 0xe6, 0x03, 0xd0, 0xb2, 0x1d, 0xe4, 0xbe, 0xa6,
+  0x5a, 0x5a, 0xa2, 0xdb, 0xfe, 0x0b, 0xfe, 0x70, 0x5e, 0x56, 0xb8, 0x79, 0x86, 0x36, 0x2a, 0xdb,
+  0x0d, 0x81, 0x78, 0xd9, 0x3c, 0x09, 0x7e, 0x7b, 0x50, 0xdb, 0x59, 0xa2, 0x87, 0xfa, 0xc2, 0x8e,
+  0x16, 0x3d, 0x50, 0x27, 0xea, 0x60, 0x0e, 0xa6, 0xf5, 0xb6, 0xa5, 0x73, 0xf8, 0x42, 0x29, 0x0c,
+  0xb7, 0x6c, 0xd5, 0x36, 0xb4, 0xcf, 0x68, 0x3b, 0x53, 0x90, 0x9f, 0xe4, 0xfc, 0xf2, 0xdd, 0xc9,
+  0x03, 0x72, 0x8f, 0xbc, 0x3c, 0x8b, 0x2f, 0x2f, 0xc6, 0x0f, 0xc9, 0x47, 0x81, 0x9a, 0x1a, 0xab,
+  0x66, 0x36, 0x5d, 0xd2, 0xb8, 0xb9, 0xa3, 0x33, 0x47, 0x18, 0xa6, 0x79, 0x85, 0xc4, 0x68, 0xd6,
+  0x9f, 0xef, 0x60, 0x41, 0xc7, 0xac, 0x98, 0x8e, 0x67, 0xb3, 0xa2, 0x78, 0xf8, 0x68, 0x72, 0x3a,
+  0xfa, 0x6a, 0xdc, 0xbb, 0x14, 0x1c, 0x1c, 0x40, 0x3b, 0xe0, 0x25, 0x7e, 0x68, 0xfd, 0x05, 0xba,
+  0xfa, 0x68, 0x30, 0xc4, 0x0a, 0x00, 0x00
+};
+
+// /assets/settings.3f22e7ef9f656ceb.css: 3749 bytes, 1254 gzipped
+static const uint8_t SETTINGS_CSS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x57, 0x5b, 0x6f, 0xa3, 0x38,
+  0x14, 0xfe, 0x2b, 0x68, 0xa2, 0xaa, 0x65, 0x37, 0x44, 0x26, 0x90, 0x4c, 0x6b, 0x9e, 0x66, 0x3a,
+  0xca, 0x6a, 0x9f, 0xf7, 0xa2, 0xdd, 0x47, 0x03, 0x0e, 0x78, 0x4b, 0x30, 0x32, 0xa4, 0x49, 0x16,
+  0xe5, 0xbf, 0xcf, 0xf1, 0x85, 0x8b, 0x49, 0xda, 0xa6, 0x45, 0x8a, 0xca, 0x71, 0x7c, 0x2e, 0xdf,
+  0xf9, 0xce, 0x67, 0x07, 0x0b, 0xce, 0x9b, 0xd6, 0xf3, 0x2a, 0xc1, 0x76, 0x44, 0x9c, 0xf0, 0x6c,
+  0xe9, 0x3f, 0xad, 0x37, 0x41, 0xd4, 0x5b, 0xbc, 0x82, 0x65, 0x79, 0x83, 0x67, 0xeb, 0xf0, 0xfb,
+  0x6a, 0xb3, 0x1e, 0xd9, 0x53, 0x22, 0x5e, 0xf0, 0xcc, 0x7f, 0xfa, 0xba, 0xfe, 0xb1, 0x04, 0x73,
+  0x4d, 0x13, 0x5e, 0xa6, 0xca, 0x05, 0x0a, 0xbe, 0x3d, 0x6d, 0x42, 0xb0, 0x91, 0x24, 0xa1, 0x25,
+  0xec, 0x45, 0xe8, 0xfb, 0xf3, 0x0f, 0x69, 0xa8, 0xf7, 0x60, 0xa9, 0x6b, 0x3c, 0x0b, 0x9f, 0xbf,
+  0x6d, 0x56, 0x08, 0x2c, 0x07, 0x22, 0x4a, 0x56, 0x66, 0x78, 0xb6, 0xd9, 0x3c, 0xfb, 0xe8, 0x2b,
+  0x58, 0x52, 0x52, 0x66, 0x54, 0x80, 0x21, 0x0c, 0x83, 0x40, 0x06, 0x8c, 0xb3, 0x2e, 0xd6, 0x52,
+  0x3e, 0xda, 0x92, 0x10, 0x91, 0x82, 0x85, 0xca, 0x07, 0x2c, 0x0d, 0x3d, 0x42, 0x9c, 0xad, 0xfa,
+  0x33, 0xaf, 0xe3, 0x8c, 0x62, 0x24, 0x1f, 0xb9, 0x93, 0x8b, 0x94, 0x0a, 0x4f, 0x90, 0x94, 0xed,
+  0x6b, 0xec, 0x2f, 0xab, 0xa3, 0xcc, 0x2a, 0x27, 0x29, 0x3f, 0x60, 0xe4, 0xf8, 0xa8, 0x3a, 0x3a,
+  0x4b, 0xf9, 0x21, 0xb2, 0x98, 0x3c, 0xa0, 0xb9, 0x7a, 0x16, 0x81, 0x2b, 0x5d, 0x0a, 0x52, 0xd6,
+  0xac, 0x61, 0xbc, 0xc4, 0xa4, 0x28, 0x1c, 0xb0, 0xd6, 0x0e, 0x25, 0x35, 0x8d, 0xce, 0xbf, 0xb4,
+  0x80, 0x47, 0xc6, 0x4a, 0x8c, 0xa2, 0x8a, 0xa4, 0xa9, 0xac, 0x06, 0x45, 0x31, 0x3f, 0x7a, 0x35,
+  0xfb, 0x5f, 0xbe, 0x98, 0x98, 0x60, 0x89, 0xce, 0x31, 0x4f, 0x4f, 0xed, 0x96, 0x97, 0x8d, 0xb7,
+  0x25, 0x3b, 0x56, 0x9c, 0xf0, 0xfd, 0x1f, 0x34, 0xe3, 0xd4, 0xf9, 0xeb, 0xf7, 0xfb, 0xf9, 0x9f,
+  0x24, 0xe7, 0x3b, 0x32, 0xff, 0x8d, 0x96, 0xf4, 0x95, 0xcc, 0xff, 0xa6, 0x02, 0x90, 0x20, 0xf3,
+  0x1a, 0xc2, 0x42, 0x29, 0x82, 0x6d, 0xa3, 0x98, 0x24, 0x2f, 0x99, 0xe0, 0xfb, 0x32, 0xf5, 0x12,
+  0x5e, 0x70, 0x81, 0x5f, 0x89, 0x78, 0xe8, 0xf1, 0x71, 0xa3, 0xb1, 0x51, 0x22, 0xe0, 0x46, 0x3b,
+  0x56, 0x7a, 0x39, 0x55, 0x0d, 0xf4, 0x11, 0x7a, 0xcd, 0xa3, 0x94, 0xd5, 0x55, 0x41, 0x4e, 0x78,
+  0x5b, 0xd0, 0x63, 0x24, 0x3f, 0xbc, 0x94, 0x09, 0x9a, 0xa8, 0xb2, 0x60, 0xfb, 0x7e, 0x57, 0xf6,
+  0x35, 0x48, 0x1c, 0x46, 0x21, 0x71, 0xc1, 0x4a, 0x4a, 0x84, 0x97, 0x49, 0xec, 0xa0, 0xab, 0x0f,
+  0x7e, 0xb0, 0x4a, 0x69, 0x36, 0x37, 0x5d, 0x71, 0xd0, 0xdd, 0x7c, 0xb6, 0x24, 0xf2, 0x01, 0x18,
+  0xd1, 0x9d, 0x1b, 0x9d, 0x17, 0x00, 0x7f, 0x43, 0x60, 0x97, 0x68, 0x0f, 0x2c, 0x6d, 0x72, 0x99,
+  0xc2, 0x5d, 0xb4, 0x23, 0x47, 0x4f, 0xbf, 0x3e, 0x21, 0x19, 0xa1, 0xc3, 0xce, 0x21, 0xfb, 0x86,
+  0xdf, 0x92, 0x5f, 0x46, 0x2a, 0x9d, 0x1b, 0x04, 0x00, 0x12, 0xb4, 0xa3, 0x14, 0x7b, 0x3c, 0xe4,
+  0x82, 0x1b, 0xd9, 0xcd, 0x36, 0x8b, 0x63, 0x9b, 0xab, 0xdb, 0xa4, 0xdb, 0xaf, 0xd7, 0xf5, 0x8b,
+  0x1b, 0xf1, 0x57, 0x2a, 0xb6, 0x05, 0x98, 0x73, 0x96, 0xa6, 0xb4, 0x34, 0xc1, 0x00, 0x4c, 0x02,
+  0xdb, 0xdb, 0x8f, 0x61, 0xd1, 0xde, 0xcc, 0xac, 0xb8, 0x12, 0x1d, 0xcb, 0xa2, 0xa7, 0xca, 0x35,
+  0x50, 0x59, 0x90, 0x2b, 0xee, 0x12, 0x58, 0x87, 0x8a, 0xc1, 0x21, 0x15, 0x76, 0x6c, 0x27, 0xf7,
+  0x35, 0x81, 0x80, 0x5d, 0x14, 0x2f, 0x43, 0xd8, 0xa1, 0x5e, 0x0f, 0xba, 0xcd, 0x6b, 0x84, 0x0c,
+  0xa4, 0x50, 0x6a, 0xd3, 0xf0, 0x1d, 0x7e, 0xec, 0x7c, 0xf6, 0x34, 0x07, 0xd6, 0x3b, 0xab, 0x29,
+  0xc9, 0x97, 0xee, 0x24, 0x4e, 0xd5, 0xf2, 0x8a, 0x24, 0xac, 0x39, 0x61, 0xb4, 0x78, 0x8a, 0x86,
+  0x90, 0x7e, 0xd8, 0x63, 0xef, 0xc9, 0x0e, 0x43, 0x8e, 0xad, 0x55, 0xc0, 0x79, 0xd1, 0x90, 0xd8,
+  0x1b, 0x9a, 0x6f, 0xf5, 0xd4, 0xce, 0x4d, 0x73, 0xac, 0x9b, 0x0f, 0x65, 0xf2, 0x21, 0xb1, 0x9a,
+  0x17, 0x2c, 0x75, 0x66, 0x41, 0x10, 0x68, 0x67, 0xbd, 0x7f, 0x35, 0xa0, 0x3e, 0xe4, 0x1e, 0x25,
+  0x7b, 0x51, 0x03, 0xd9, 0x2b, 0xce, 0x14, 0x44, 0x17, 0xa3, 0xa1, 0xc6, 0xb5, 0x22, 0x02, 0xb2,
+  0x33, 0x01, 0x70, 0xc9, 0x4b, 0x7a, 0x31, 0x23, 0x83, 0x4a, 0xb8, 0xd3, 0x1a, 0x2b, 0x6e, 0xe6,
+  0x5d, 0xd0, 0x82, 0x34, 0xec, 0x95, 0xea, 0x64, 0x16, 0x24, 0x91, 0x2f, 0xed, 0xd8, 0x53, 0xd7,
+  0x67, 0xeb, 0x1b, 0x18, 0x93, 0x2d, 0xe4, 0xd6, 0x1a, 0x90, 0xf0, 0xfd, 0xfd, 0xe0, 0x92, 0xc4,
+  0x50, 0xe3, 0xbe, 0xa1, 0x91, 0xa9, 0xda, 0x83, 0xb2, 0xa3, 0x82, 0x6e, 0x1b, 0x90, 0x8e, 0xd1,
+  0xb0, 0x98, 0xd9, 0x5d, 0x5a, 0x93, 0xe8, 0xbd, 0x11, 0x79, 0xcb, 0xc5, 0xce, 0x13, 0xfc, 0xd0,
+  0x5e, 0xc1, 0xd8, 0xac, 0x16, 0x24, 0xa6, 0x45, 0xdf, 0x90, 0xb8, 0xe0, 0xc9, 0xcb, 0x15, 0xb6,
+  0x4c, 0x70, 0x78, 0x0f, 0x32, 0xe3, 0x97, 0x95, 0xd5, 0xbe, 0x19, 0x4f, 0x79, 0xdf, 0x30, 0x3b,
+  0x75, 0x6c, 0x24, 0xa2, 0x6b, 0xc9, 0xa8, 0xd9, 0x61, 0x18, 0xde, 0x32, 0xb0, 0x97, 0x1a, 0x37,
+  0xca, 0x76, 0xad, 0x2a, 0x55, 0xc9, 0x78, 0x32, 0x60, 0x65, 0x73, 0x4f, 0x0d, 0x95, 0xc7, 0x1a,
+  0xba, 0xab, 0x87, 0xd1, 0x1a, 0x7d, 0xdb, 0x19, 0x17, 0x23, 0x77, 0x60, 0xbf, 0x4b, 0xa9, 0xe1,
+  0x95, 0x27, 0x64, 0x2f, 0xba, 0xe4, 0x90, 0x4d, 0xdb, 0xe9, 0xa2, 0xe5, 0xd7, 0x23, 0x55, 0x45,
+  0x4b, 0x4b, 0xa9, 0x54, 0xb9, 0x63, 0x90, 0x34, 0xab, 0xdf, 0x8a, 0xf6, 0x86, 0x76, 0xbd, 0x99,
+  0xc0, 0x4d, 0xd0, 0xd9, 0x7d, 0x6c, 0x78, 0x96, 0x15, 0xd4, 0xab, 0x0f, 0xac, 0x49, 0xf2, 0xf6,
+  0x92, 0xfb, 0x1d, 0x92, 0xac, 0x94, 0x8a, 0xe7, 0x69, 0xee, 0xe8, 0x8e, 0xaf, 0x25, 0xc3, 0x0c,
+  0x55, 0x03, 0xad, 0x0e, 0x96, 0x37, 0x47, 0x23, 0xda, 0xcb, 0x89, 0xd9, 0x86, 0xba, 0x3d, 0x68,
+  0xb4, 0x01, 0xb8, 0x00, 0x23, 0x73, 0x39, 0x27, 0x93, 0x79, 0x07, 0x84, 0x60, 0x9b, 0x19, 0x18,
+  0x61, 0xbc, 0x18, 0x0a, 0xa3, 0xcb, 0x59, 0x51, 0x52, 0x32, 0x3a, 0xc1, 0x17, 0x61, 0x3d, 0x21,
+  0xdb, 0x24, 0x6f, 0x95, 0x06, 0x8e, 0x29, 0x10, 0x82, 0x5e, 0xcb, 0xc6, 0x8c, 0xf4, 0x97, 0x2f,
+  0xfd, 0x88, 0x4a, 0xee, 0xe9, 0xba, 0xd4, 0xbf, 0x2a, 0xb5, 0x50, 0xb5, 0x54, 0x25, 0x15, 0x5e,
+  0x1b, 0xe1, 0x43, 0x0e, 0x64, 0x7c, 0x3f, 0xaf, 0x15, 0x0c, 0xd3, 0x59, 0xe1, 0x87, 0x93, 0x9c,
+  0x26, 0x2f, 0x34, 0x75, 0x7e, 0x75, 0x26, 0x68, 0x7d, 0x28, 0x0d, 0xef, 0xef, 0xef, 0xca, 0x54,
+  0x79, 0xc8, 0x09, 0xd0, 0xe2, 0x09, 0x7d, 0xa7, 0xff, 0x3c, 0xc8, 0x62, 0x46, 0xf4, 0x78, 0x43,
+  0xd5, 0xff, 0xdb, 0xd7, 0x0d, 0xdb, 0x9e, 0xba, 0xf3, 0x00, 0x83, 0xf2, 0x26, 0xc0, 0x11, 0xda,
+  0x1c, 0x28, 0x9c, 0x9d, 0x57, 0xe6, 0xee, 0xaa, 0x44, 0x99, 0x18, 0x5a, 0xa4, 0x3e, 0x25, 0x42,
+  0xdd, 0x81, 0x23, 0xcf, 0xa2, 0x2e, 0x31, 0x25, 0xf7, 0xd6, 0x52, 0xa7, 0xdc, 0xb6, 0xfe, 0x49,
+  0x09, 0xe3, 0x52, 0xa7, 0x2f, 0x0f, 0xde, 0x7e, 0x40, 0xe5, 0x69, 0xd9, 0x9f, 0xab, 0x92, 0x7b,
+  0x01, 0xb2, 0x75, 0x72, 0xf9, 0x61, 0x8a, 0xf1, 0x1e, 0x4a, 0x2d, 0x27, 0xb1, 0xaf, 0x29, 0xe6,
+  0xea, 0xa6, 0x6b, 0xd7, 0xa7, 0xee, 0x17, 0x63, 0xb6, 0x8d, 0x0f, 0xc3, 0x1b, 0xf4, 0x76, 0xa2,
+  0xae, 0xd3, 0xab, 0xc6, 0x74, 0x2c, 0x07, 0x2a, 0x1b, 0x1c, 0x7a, 0x83, 0xab, 0x2f, 0x21, 0x03,
+  0xc9, 0xf6, 0x20, 0x8a, 0x22, 0x91, 0x37, 0xe8, 0x82, 0x36, 0xb0, 0xd9, 0x93, 0xa4, 0x51, 0x08,
+  0x5c, 0xbd, 0x04, 0x29, 0x4b, 0x0a, 0x88, 0x0a, 0xa2, 0xfc, 0xab, 0x02, 0x46, 0x1d, 0x31, 0x1c,
+  0xd2, 0x30, 0xe3, 0x5c, 0xde, 0xdf, 0xae, 0x31, 0xfa, 0xdf, 0x07, 0x2f, 0x90, 0x8c, 0x1e, 0x5d,
+  0xfc, 0x90, 0xf3, 0x68, 0x5d, 0xfb, 0x83, 0x60, 0xee, 0xaf, 0xd0, 0x7c, 0x19, 0x06, 0x70, 0x2d,
+  0x0a, 0x87, 0xde, 0x0d, 0xfd, 0xbc, 0xf9, 0xfe, 0x37, 0x30, 0x60, 0xe8, 0x90, 0xfe, 0x51, 0xe4,
+  0xf6, 0xb7, 0xe4, 0xce, 0xb9, 0xfe, 0x69, 0x74, 0xbb, 0x6b, 0xfd, 0x7d, 0xe5, 0x78, 0xf6, 0xe8,
+  0x3f, 0x7f, 0x7d, 0x0c, 0x3b, 0x97, 0xa4, 0xf3, 0x29, 0x7d, 0xb5, 0x57, 0x85, 0xdb, 0xba, 0x50,
+  0x2d, 0x87, 0x7b, 0xb8, 0x7d, 0x31, 0x1b, 0x9d, 0x57, 0x52, 0x40, 0x2d, 0xd1, 0xba, 0xd6, 0x8e,
+  0xcf, 0xf1, 0x49, 0x29, 0xae, 0x95, 0xab, 0x69, 0xdb, 0xf4, 0x9c, 0x3c, 0xff, 0x04, 0xe9, 0xe6,
+  0xcf, 0x42, 0xa5, 0x0e, 0x00, 0x00
+};
+
+// /assets/settings.4e1b36d82b086514.js: 2063 bytes, 602 gzipped
+static const uint8_t SETTINGS_JS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x95, 0xc1, 0x8e, 0xda, 0x30,
+  0x10, 0x86, 0xef, 0x3c, 0x45, 0x6e, 0x49, 0xa4, 0x6e, 0x7a, 0x2f, 0xda, 0x4a, 0xdb, 0x82, 0x04,
+  0x12, 0x68, 0x2b, 0x81, 0xda, 0xf3, 0x60, 0x4f, 0x48, 0x8a, 0x63, 0x53, 0x7b, 0x02, 0x42, 0xd5,
+  0xbe, 0x7b, 0xc7, 0x81, 0xb0, 0x81, 0x26, 0x66, 0x0f, 0x91, 0x1c, 0xcf, 0x3f, 0x9f, 0x67, 0x7e,
+  0x5b, 0xb6, 0x34, 0xa2, 0xae, 0x50, 0x53, 0x06, 0x52, 0x4e, 0x0f, 0x3c, 0x58, 0x94, 0x8e, 0x50,
+  0xa3, 0x4d, 0xe2, 0xc9, 0xeb, 0xf2, 0xbb, 0xd1, 0xe4, 0xe7, 0x0c, 0x48, 0x94, 0xf1, 0xa7, 0x28,
+  0xaf, 0xb5, 0xa0, 0xd2, 0xe8, 0x24, 0x8d, 0xfe, 0x8e, 0x72, 0x24, 0x51, 0xac, 0x90, 0xa8, 0xd4,
+  0x5b, 0x97, 0xa4, 0xe3, 0x91, 0x43, 0xaa, 0xf7, 0x6b, 0xd8, 0xcc, 0x40, 0x4b, 0x85, 0xb6, 0x99,
+  0x7b, 0xe3, 0xaf, 0xcd, 0x8a, 0xfe, 0x17, 0x30, 0x46, 0x18, 0xed, 0x28, 0x22, 0xd8, 0xb8, 0xe8,
+  0x39, 0x92, 0x6d, 0x39, 0x7f, 0x6a, 0xb4, 0xa7, 0x15, 0x2a, 0x14, 0x64, 0xec, 0x8b, 0x52, 0x49,
+  0x9c, 0xb1, 0x24, 0x66, 0x9a, 0x57, 0x66, 0xb9, 0xb1, 0x53, 0x10, 0x45, 0xc2, 0x3f, 0xd1, 0xf3,
+  0x57, 0xa6, 0xf0, 0xa0, 0xa7, 0x05, 0xa1, 0x4a, 0xb1, 0xbb, 0xaf, 0xfb, 0x16, 0xe0, 0xd3, 0x29,
+  0x13, 0x0a, 0x9c, 0xf3, 0x79, 0x99, 0xc5, 0xca, 0x1c, 0x30, 0x89, 0x81, 0x13, 0x0e, 0x18, 0xa7,
+  0x7e, 0xc5, 0xa2, 0x74, 0x1d, 0x05, 0x2f, 0xf3, 0x1e, 0x1e, 0x8f, 0x1e, 0x94, 0xfc, 0x24, 0xce,
+  0x1e, 0xc6, 0xe9, 0x75, 0xcd, 0xcb, 0xcc, 0xb9, 0xf0, 0xcb, 0x4f, 0xa0, 0x82, 0xb3, 0x89, 0x57,
+  0x9b, 0xe6, 0x92, 0x7d, 0x6a, 0x4a, 0xda, 0x22, 0xbd, 0x10, 0xd9, 0x72, 0x53, 0x13, 0xcb, 0x25,
+  0x10, 0x3c, 0x5d, 0x3c, 0xba, 0xd6, 0xc4, 0x92, 0xa9, 0x42, 0x3f, 0xfc, 0x76, 0x9a, 0xcb, 0xa4,
+  0x49, 0x4f, 0x87, 0x7b, 0x79, 0x6b, 0xbf, 0xf7, 0x3d, 0xbb, 0xdb, 0xe5, 0x76, 0xdf, 0x93, 0xf8,
+  0xb3, 0xbb, 0x4c, 0xc6, 0xe9, 0x28, 0xa3, 0x02, 0x75, 0x62, 0xd1, 0xed, 0xb9, 0x4a, 0xf4, 0x8d,
+  0xb5, 0xe3, 0xec, 0xb7, 0xf3, 0xb6, 0xb7, 0x92, 0x36, 0xe7, 0xdc, 0xfb, 0x50, 0x99, 0x31, 0x81,
+  0xde, 0xcd, 0xb0, 0xdc, 0x16, 0xde, 0xb6, 0x03, 0xa8, 0x9a, 0x99, 0x51, 0x9b, 0x9b, 0xbd, 0x47,
+  0xc7, 0x61, 0xc4, 0xa4, 0x84, 0x0a, 0x09, 0xed, 0x10, 0xa4, 0x8d, 0x3f, 0xc0, 0xfc, 0x34, 0x8a,
+  0x83, 0x43, 0x90, 0x73, 0x34, 0x80, 0x70, 0xa8, 0x9d, 0xb1, 0xaf, 0x79, 0xce, 0x69, 0x7d, 0x90,
+  0x6e, 0x3c, 0x80, 0xc1, 0x6a, 0x4f, 0xa7, 0x09, 0x6f, 0x1a, 0x68, 0xd1, 0x5b, 0xcc, 0x8d, 0x20,
+  0x00, 0xca, 0x6b, 0xa5, 0x42, 0x9c, 0x6e, 0x3c, 0x80, 0xa9, 0x10, 0x5c, 0x6d, 0x9b, 0x89, 0x39,
+  0x1f, 0x61, 0xcb, 0x9c, 0x3e, 0x5a, 0x8f, 0x2c, 0x00, 0xb5, 0x08, 0x92, 0xd3, 0x56, 0x95, 0x31,
+  0x7c, 0xc4, 0xf5, 0xb6, 0x8f, 0x78, 0xaf, 0x09, 0xb5, 0x5a, 0x2a, 0x5e, 0xf2, 0x57, 0xa9, 0xa5,
+  0x39, 0xf6, 0xb6, 0xda, 0x89, 0x07, 0x30, 0x05, 0x54, 0x7b, 0x54, 0xeb, 0x82, 0x0f, 0x75, 0x61,
+  0x94, 0xec, 0x23, 0xdd, 0x49, 0x02, 0x30, 0x85, 0x07, 0x16, 0x5a, 0x10, 0xbb, 0xe6, 0x60, 0x8a,
+  0x02, 0x79, 0x24, 0xbb, 0xac, 0xae, 0x22, 0x00, 0x82, 0xd2, 0xae, 0x79, 0xcf, 0xd1, 0x02, 0xb1,
+  0xc1, 0x7d, 0x45, 0xdd, 0x2a, 0x42, 0x28, 0x09, 0x7b, 0x7f, 0x07, 0xac, 0xb8, 0x0b, 0x75, 0xb6,
+  0xbd, 0xa7, 0xae, 0x7b, 0x55, 0xc8, 0x78, 0x70, 0xb4, 0xfc, 0xd8, 0x01, 0x19, 0x90, 0x86, 0x1c,
+  0x34, 0xc7, 0x1f, 0xe6, 0x88, 0x76, 0x69, 0x24, 0x0e, 0x38, 0xd8, 0x51, 0x84, 0xda, 0xe6, 0x47,
+  0x88, 0x16, 0xde, 0xed, 0x45, 0xff, 0xf9, 0xb8, 0x11, 0x7c, 0x08, 0x34, 0xe3, 0x6b, 0x29, 0x4c,
+  0xf2, 0x8a, 0x47, 0x28, 0x37, 0xd5, 0xb0, 0x51, 0x28, 0x07, 0xf6, 0xa1, 0x2b, 0xf1, 0x17, 0xf6,
+  0x28, 0x13, 0xe0, 0xef, 0x64, 0xb4, 0xd6, 0xd8, 0xeb, 0xb3, 0xe2, 0x8c, 0xc2, 0xac, 0x99, 0x4a,
+  0xe2, 0x69, 0x13, 0x69, 0x6e, 0x6e, 0x46, 0x5c, 0x51, 0x5f, 0xf8, 0x6d, 0x6c, 0x14, 0xed, 0xbd,
+  0xff, 0x0f, 0x88, 0x55, 0x3b, 0xc3, 0x0f, 0x08, 0x00, 0x00
+};
+
+// /settings.html: 6926 bytes, 1477 gzipped
+static const uint8_t SETTINGS_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x99, 0x6d, 0x6f, 0xdb, 0x36,
+  0x10, 0x80, 0xbf, 0xef, 0x57, 0x70, 0x02, 0xd6, 0xb8, 0xd8, 0x9c, 0xd8, 0x79, 0x5b, 0x87, 0xc6,
+  0x01, 0xb2, 0x24, 0x5d, 0x07, 0x34, 0x68, 0x51, 0x67, 0x2b, 0xf6, 0x91, 0x92, 0x4e, 0x16, 0x1b,
+  0x8a, 0xd4, 0x48, 0xca, 0x6e, 0x80, 0xfd, 0xf8, 0x1d, 0x45, 0xc9, 0x96, 0x14, 0xc9, 0xd6, 0xac,
+  0x74, 0xfd, 0x62, 0x5b, 0xd4, 0xe9, 0xee, 0xf8, 0xf0, 0x5e, 0x48, 0xeb, 0xe2, 0xfb, 0x9b, 0xf7,
+  0xd7, 0xf7, 0x7f, 0x7d, 0xb8, 0x25, 0xb1, 0x49, 0xf8, 0xe5, 0x77, 0x17, 0xf6, 0x8b, 0x70, 0x2a,
+  0x16, 0x33, 0x0f, 0x84, 0x67, 0x07, 0x80, 0x86, 0xf8, 0x65, 0x98, 0xe1, 0x70, 0x79, 0x4f, 0xc5,
+  0x03, 0x99, 0x83, 0x31, 0x4c, 0x2c, 0x34, 0x19, 0x93, 0xab, 0xbf, 0x33, 0xfa, 0x0e, 0x96, 0xc0,
+  0xc9, 0x9d, 0x14, 0xcc, 0x48, 0x75, 0x71, 0xe4, 0x04, 0xbf, 0xbb, 0x48, 0xc0, 0x50, 0x22, 0x68,
+  0x02, 0xb3, 0x83, 0x25, 0x83, 0x55, 0x2a, 0x95, 0x39, 0x20, 0x81, 0x14, 0x06, 0x84, 0x99, 0x1d,
+  0xac, 0x58, 0x68, 0xe2, 0x59, 0x08, 0x4b, 0x16, 0xc0, 0x38, 0xbf, 0xf8, 0x89, 0x30, 0xd4, 0xc0,
+  0x28, 0x1f, 0xeb, 0x80, 0x72, 0x98, 0x4d, 0x0f, 0x50, 0x09, 0x67, 0x68, 0x4f, 0x01, 0x9f, 0x79,
+  0xda, 0x3c, 0x72, 0xd0, 0x31, 0x80, 0xf1, 0x48, 0xac, 0x20, 0x9a, 0x79, 0x47, 0x54, 0x6b, 0x30,
+  0xfa, 0x48, 0x17, 0xee, 0x1c, 0x9e, 0x44, 0xc7, 0xc7, 0xf0, 0x33, 0x44, 0xbf, 0x44, 0xe7, 0x67,
+  0xe7, 0x01, 0xf8, 0x87, 0x81, 0xd6, 0x76, 0x06, 0x47, 0xc5, 0x14, 0x7c, 0x19, 0x3e, 0xe2, 0x57,
+  0xc8, 0x96, 0x24, 0xe0, 0xf8, 0xf0, 0xcc, 0xb3, 0xee, 0x50, 0x26, 0x40, 0x59, 0x31, 0x5a, 0xea,
+  0xf5, 0xca, 0xdb, 0x7e, 0x66, 0x8c, 0x14, 0x63, 0x9f, 0x06, 0x0f, 0xde, 0xe5, 0x0b, 0x4e, 0x95,
+  0x7a, 0x4d, 0x7e, 0xc5, 0x0b, 0x62, 0x24, 0xb9, 0xa1, 0x3a, 0xf6, 0x25, 0x55, 0xe1, 0xc5, 0x11,
+  0x6d, 0x28, 0xc5, 0x41, 0xef, 0xe9, 0xd0, 0xd8, 0x7a, 0xe1, 0x2c, 0xc5, 0xd3, 0x3a, 0x48, 0xf4,
+  0x70, 0x8a, 0xc3, 0xe9, 0xe5, 0xb5, 0x14, 0x11, 0x5b, 0x64, 0x0a, 0xc8, 0xa3, 0xcc, 0x14, 0x59,
+  0x51, 0x03, 0x8a, 0x18, 0x2b, 0x9a, 0x52, 0x85, 0x28, 0xf1, 0x12, 0x85, 0x53, 0x3b, 0x27, 0xd4,
+  0xde, 0x62, 0xa3, 0xe0, 0xdb, 0x30, 0x6f, 0xa8, 0x3f, 0xae, 0x4d, 0xd5, 0x4d, 0xac, 0x72, 0x9b,
+  0xd0, 0xc0, 0xb0, 0x25, 0x78, 0x24, 0xa4, 0x86, 0x8e, 0x71, 0xc0, 0x8e, 0x8a, 0x87, 0xd2, 0x41,
+  0xcf, 0xf9, 0x7b, 0xc3, 0x12, 0x10, 0x9a, 0x49, 0x81, 0x4e, 0x38, 0x15, 0x6d, 0xba, 0xaa, 0x4a,
+  0x70, 0x21, 0x95, 0xd9, 0x68, 0xb9, 0xb2, 0x97, 0x95, 0x69, 0xf7, 0x53, 0xa2, 0xd1, 0xa8, 0x54,
+  0x1b, 0x2d, 0xf3, 0xfc, 0x9a, 0x5c, 0x53, 0xce, 0x7c, 0x45, 0x0d, 0xfa, 0x53, 0xd1, 0x54, 0x01,
+  0xc3, 0xc2, 0xc6, 0x2c, 0x9a, 0x3c, 0x90, 0x54, 0x39, 0x71, 0x7c, 0x24, 0x92, 0x2a, 0xc9, 0x2f,
+  0xa5, 0xc0, 0x20, 0xd0, 0x36, 0xd0, 0x90, 0x78, 0x2c, 0x51, 0xcb, 0x6f, 0xb7, 0xf7, 0x0d, 0xa4,
+  0x56, 0x78, 0xac, 0xe4, 0xca, 0x0e, 0x73, 0xea, 0x63, 0x02, 0xe0, 0x88, 0x33, 0xf7, 0x16, 0xd8,
+  0x22, 0x36, 0x5e, 0x4d, 0x32, 0x17, 0x29, 0x28, 0xba, 0xfb, 0x17, 0x47, 0xf9, 0x58, 0x5d, 0x2b,
+  0x13, 0x69, 0x66, 0xc6, 0x0b, 0x25, 0xb3, 0xd4, 0x2a, 0xce, 0x2f, 0x89, 0x79, 0x4c, 0x61, 0xe6,
+  0x89, 0x2c, 0xf1, 0x71, 0xf1, 0xd6, 0x93, 0x2a, 0xad, 0xe4, 0x19, 0xd6, 0x69, 0x37, 0xd7, 0xe0,
+  0x11, 0x6d, 0x20, 0x9d, 0x79, 0x93, 0xc3, 0x29, 0x4e, 0x89, 0xe1, 0xec, 0xa6, 0x13, 0xfc, 0x41,
+  0xbf, 0xd8, 0x1f, 0x93, 0x89, 0xd7, 0xe9, 0xc3, 0x98, 0xa6, 0x29, 0x08, 0x0c, 0xe6, 0x20, 0x29,
+  0xb9, 0xd6, 0xbf, 0xfa, 0x01, 0xb9, 0x61, 0x2e, 0x74, 0xbb, 0x91, 0x94, 0x12, 0x43, 0xa1, 0x6c,
+  0x2c, 0x6d, 0xb0, 0xb4, 0x5b, 0xdf, 0x05, 0xe6, 0xec, 0x7f, 0xe0, 0xf2, 0xa7, 0xe4, 0x59, 0x02,
+  0xdd, 0x54, 0xdc, 0xfd, 0xa1, 0x4c, 0x4a, 0x2b, 0x1b, 0x22, 0x6d, 0x76, 0xbb, 0x78, 0x54, 0xe2,
+  0xa4, 0x0f, 0x10, 0xce, 0x5c, 0x89, 0x6a, 0x83, 0x52, 0xe4, 0xb8, 0xf3, 0x52, 0x67, 0x7e, 0xc2,
+  0x4c, 0xa3, 0xd2, 0x92, 0xa2, 0xe0, 0xea, 0x2c, 0x08, 0xc0, 0xd6, 0xee, 0x39, 0x5d, 0x02, 0x69,
+  0x94, 0xca, 0x4d, 0xa6, 0x5b, 0xc7, 0x9f, 0x66, 0x7c, 0xbd, 0xe4, 0xb4, 0xa4, 0xfc, 0x73, 0xe5,
+  0x7a, 0x6e, 0x28, 0x6f, 0x7e, 0xef, 0xf0, 0x5e, 0xdb, 0x2a, 0xe2, 0x38, 0xf9, 0x94, 0xd7, 0x70,
+  0x57, 0xf8, 0x72, 0xe1, 0x21, 0xeb, 0xd9, 0x30, 0xe9, 0x96, 0x74, 0x8b, 0x1f, 0xc5, 0xaa, 0xe6,
+  0x4b, 0x59, 0x49, 0xf9, 0x1e, 0x0b, 0xf9, 0xc3, 0xbe, 0x81, 0xbd, 0xf1, 0xe6, 0x2d, 0x96, 0xa3,
+  0x56, 0x2c, 0xf6, 0xc6, 0xd7, 0xe2, 0xe2, 0x8c, 0x36, 0xc1, 0x3c, 0x75, 0xe5, 0x6b, 0x92, 0x31,
+  0x72, 0xb1, 0xe0, 0x50, 0xef, 0xb8, 0x3a, 0xa5, 0xa2, 0x71, 0xbf, 0xa0, 0x71, 0x2b, 0xa8, 0xcf,
+  0xc1, 0x91, 0xc0, 0xf0, 0xb6, 0x82, 0x6b, 0xa2, 0xf5, 0x07, 0xf4, 0x8a, 0x99, 0x20, 0x6e, 0x72,
+  0x08, 0x62, 0x08, 0x1e, 0x7c, 0xf9, 0xa5, 0x42, 0x42, 0x3b, 0x9d, 0x61, 0x0d, 0xc4, 0x66, 0x70,
+  0x49, 0x79, 0x66, 0x4b, 0x81, 0xca, 0xa0, 0xc3, 0x35, 0xcd, 0x59, 0xbe, 0x55, 0x59, 0xbb, 0xb3,
+  0x5e, 0x9b, 0x81, 0xb9, 0xdc, 0xb9, 0x01, 0xe8, 0x48, 0xe6, 0x46, 0xeb, 0xff, 0x8a, 0xd9, 0xec,
+  0x2c, 0xbd, 0x8f, 0xa2, 0xfc, 0xf1, 0x96, 0xa8, 0x2d, 0x76, 0x1d, 0x4e, 0x82, 0x8c, 0x42, 0xa6,
+  0xb1, 0x96, 0x06, 0x40, 0x22, 0x25, 0x13, 0xe2, 0x9e, 0xb6, 0xfb, 0x42, 0x8c, 0xa4, 0x62, 0xdf,
+  0xc6, 0x6d, 0xe4, 0xbd, 0x1c, 0x12, 0xd6, 0x75, 0x9f, 0xdc, 0x5a, 0x76, 0xfb, 0xd9, 0x51, 0xc2,
+  0xff, 0x5b, 0x74, 0xef, 0xdf, 0xd1, 0x20, 0x49, 0xcd, 0xe3, 0x4d, 0x41, 0xa5, 0x95, 0xe0, 0xad,
+  0x95, 0x20, 0x45, 0xc3, 0x2f, 0xe8, 0x8d, 0x1a, 0xf8, 0x7c, 0x89, 0x01, 0x91, 0x0c, 0xa2, 0xd6,
+  0x70, 0xc4, 0x61, 0xdb, 0xe2, 0xdd, 0xb7, 0xde, 0x0a, 0x44, 0x19, 0xe7, 0x5b, 0xb9, 0xbd, 0x41,
+  0x81, 0x1d, 0xd8, 0x5c, 0xc4, 0xad, 0x62, 0x10, 0xc4, 0xaa, 0x1b, 0xc4, 0xaf, 0xee, 0x8f, 0xc3,
+  0xd7, 0xed, 0xe3, 0x37, 0x8e, 0xba, 0x04, 0xa8, 0xc6, 0xf3, 0x12, 0x9e, 0x4b, 0xcc, 0xef, 0x58,
+  0x0f, 0x14, 0xd6, 0xb6, 0x56, 0x86, 0x77, 0x1b, 0x39, 0x52, 0x0a, 0x0e, 0x81, 0xd4, 0x6a, 0xd7,
+  0xb1, 0xda, 0xe9, 0x52, 0xb5, 0xf7, 0x94, 0x1b, 0xac, 0xf3, 0x3e, 0x98, 0x34, 0x60, 0xd1, 0x0b,
+  0xf5, 0x33, 0x37, 0xa0, 0xab, 0x90, 0xa6, 0xf6, 0x0c, 0x44, 0xe6, 0x34, 0x49, 0xf1, 0xc0, 0xbd,
+  0xc0, 0xe8, 0xa2, 0xda, 0xc5, 0x13, 0xc3, 0xce, 0x14, 0x31, 0x9e, 0x8f, 0x62, 0xa4, 0x85, 0x0a,
+  0xf5, 0xe1, 0xef, 0x97, 0xc3, 0xfb, 0x54, 0x61, 0xb4, 0xb4, 0xb9, 0x6e, 0x55, 0x4f, 0xc6, 0x1b,
+  0xdd, 0xaa, 0xaa, 0x32, 0x66, 0x61, 0x08, 0x62, 0xe7, 0xa3, 0x11, 0xe5, 0x7a, 0xef, 0x4e, 0xb7,
+  0x37, 0x56, 0xdc, 0x8c, 0x8d, 0x3f, 0xc8, 0x15, 0x62, 0xbc, 0x93, 0x21, 0x66, 0x6c, 0x08, 0x90,
+  0x12, 0xcd, 0xed, 0xa7, 0x0f, 0x66, 0x05, 0x98, 0xaa, 0x95, 0x48, 0xd1, 0xc3, 0x91, 0x72, 0xb9,
+  0xca, 0xed, 0x59, 0x73, 0x25, 0x93, 0xfa, 0x58, 0x6f, 0x94, 0xad, 0x8f, 0x3d, 0x17, 0xc6, 0xae,
+  0x32, 0x88, 0x31, 0x77, 0xd7, 0x33, 0x9b, 0xdf, 0xd8, 0xf8, 0xd4, 0x86, 0xb4, 0x65, 0x35, 0x19,
+  0xb9, 0xb0, 0x35, 0x31, 0xb8, 0x16, 0x4c, 0x98, 0x26, 0x41, 0x4c, 0xc5, 0xc2, 0x05, 0xee, 0x80,
+  0xc2, 0xd8, 0xe5, 0x61, 0x51, 0x23, 0xfb, 0x4c, 0xa0, 0x9a, 0xfb, 0xc7, 0x93, 0xc9, 0x3a, 0xfb,
+  0xed, 0xf1, 0xaa, 0x28, 0xa2, 0xfd, 0x4a, 0x66, 0xa2, 0xf7, 0x2d, 0x99, 0x0a, 0x68, 0x88, 0x28,
+  0xe6, 0x89, 0x94, 0x26, 0xce, 0xf3, 0xa4, 0x85, 0xf0, 0x47, 0x27, 0x44, 0xd6, 0x52, 0x64, 0xe4,
+  0x50, 0x10, 0x19, 0x91, 0x42, 0x83, 0xb6, 0x9d, 0x07, 0x77, 0x75, 0x8a, 0x2e, 0x60, 0x10, 0xd8,
+  0xa7, 0x1e, 0x39, 0xa2, 0xdb, 0x3d, 0x6d, 0x2b, 0xa3, 0x67, 0x7d, 0xd0, 0x95, 0xee, 0xef, 0xdd,
+  0xb0, 0x19, 0xc7, 0xa5, 0xfd, 0xc4, 0x44, 0xd8, 0x71, 0xee, 0x7b, 0x9f, 0x19, 0xce, 0x10, 0xd5,
+  0x9b, 0x5c, 0x90, 0x38, 0x49, 0x32, 0xd2, 0xb1, 0x34, 0x9a, 0x30, 0x91, 0x87, 0xa6, 0xca, 0x84,
+  0xad, 0xa4, 0x58, 0x03, 0x42, 0x46, 0xc5, 0xb0, 0xb8, 0xac, 0xf9, 0x53, 0x04, 0x63, 0xa7, 0x8f,
+  0x6d, 0xd8, 0x4e, 0xa6, 0x7d, 0xba, 0x8f, 0x75, 0x7f, 0x5f, 0x66, 0x31, 0x16, 0x65, 0xe0, 0xf7,
+  0xb1, 0x02, 0x54, 0xc3, 0xc3, 0xad, 0xd8, 0xd6, 0x52, 0x64, 0x34, 0x21, 0xb8, 0xcf, 0xb6, 0xc7,
+  0x16, 0x8d, 0x41, 0xf7, 0x19, 0xf2, 0x2d, 0xfe, 0x20, 0x56, 0x4f, 0xfc, 0x70, 0xb8, 0xb6, 0xba,
+  0xb7, 0x73, 0x8b, 0xd3, 0x03, 0xde, 0xdd, 0xd5, 0xcd, 0xde, 0x27, 0x6a, 0xa6, 0xee, 0x71, 0xfb,
+  0x8a, 0x69, 0x66, 0xb0, 0xb4, 0xb4, 0x92, 0xbb, 0x62, 0x48, 0x6d, 0x23, 0x43, 0x46, 0x99, 0x86,
+  0xd0, 0x6d, 0x07, 0x85, 0x24, 0xa6, 0x72, 0xa7, 0xd8, 0x32, 0x62, 0x49, 0x8c, 0x98, 0x31, 0x10,
+  0x0e, 0x82, 0xd9, 0xf4, 0xac, 0xe8, 0xc3, 0x5b, 0xfc, 0xad, 0x06, 0xdf, 0xf8, 0xb4, 0x24, 0xf8,
+  0xea, 0xac, 0x07, 0xc1, 0x17, 0x21, 0x2c, 0x5e, 0x5f, 0x3f, 0xf3, 0xde, 0xc7, 0x36, 0xe9, 0x77,
+  0x74, 0xe1, 0xfe, 0x81, 0x20, 0xf7, 0x8a, 0x06, 0x0f, 0x98, 0x94, 0xc3, 0x5b, 0xb1, 0x55, 0x97,
+  0x6b, 0xdb, 0xfc, 0x17, 0x59, 0x1f, 0xeb, 0xdf, 0x8a, 0xdb, 0x1e, 0x1b, 0xd4, 0x8a, 0xf7, 0x3d,
+  0xbb, 0x17, 0x07, 0xe0, 0xdd, 0x87, 0xf7, 0xdd, 0x71, 0x2e, 0x8d, 0x5b, 0x98, 0xf4, 0xd2, 0xfd,
+  0x0d, 0x94, 0x1f, 0x6e, 0x8a, 0x37, 0x48, 0xe4, 0x1f, 0x72, 0x3b, 0xff, 0x70, 0x72, 0x4c, 0x7e,
+  0x24, 0x6f, 0xaf, 0xc7, 0xf3, 0x8f, 0x93, 0x53, 0xf2, 0x07, 0x37, 0x8a, 0x6a, 0xbc, 0x1d, 0x14,
+  0x4e, 0xd4, 0xde, 0x81, 0xe8, 0x40, 0xb1, 0xd4, 0x10, 0xad, 0x82, 0x96, 0x77, 0x42, 0xa7, 0x30,
+  0xf5, 0x4f, 0xce, 0xc3, 0x57, 0xc7, 0xfe, 0xe4, 0xd5, 0xf9, 0xd9, 0xf4, 0xf4, 0xf0, 0xb3, 0xce,
+  0xd1, 0xe4, 0xcf, 0x58, 0x1d, 0xc5, 0x4b, 0xa1, 0xa3, 0xfc, 0xf5, 0xd7, 0xbf, 0xad, 0x6f, 0x7f,
+  0xce, 0x0e, 0x1b, 0x00, 0x00
+};
+
+// /assets/network.056160d11941efc3.css: 3552 bytes, 1216 gzipped
+static const uint8_t NETWORK_CSS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x56, 0xdb, 0x6e, 0xe3, 0x36,
+  0x10, 0xfd, 0x15, 0x01, 0x46, 0xb0, 0x51, 0x61, 0x19, 0xd4, 0xc5, 0xce, 0x86, 0x7a, 0xe9, 0x6e,
+  0x16, 0x2e, 0xfa, 0xdc, 0x6d, 0x81, 0x3e, 0xd2, 0x12, 0x25, 0xb1, 0x91, 0x49, 0x81, 0xa4, 0x7c,
+  0xa9, 0xe0, 0x7f, 0xef, 0x90, 0xba, 0x58, 0x92, 0x8d, 0xc6, 0x09, 0x81, 0xc0, 0x1a, 0x92, 0x73,
+  0x3d, 0x73, 0x38, 0x58, 0x0a, 0xa1, 0x1b, 0xcf, 0xab, 0x24, 0xdb, 0x13, 0x79, 0xc6, 0x8b, 0xc0,
+  0x7f, 0xdd, 0x6c, 0xc3, 0x78, 0x90, 0x78, 0x25, 0xcb, 0x0b, 0x8d, 0x17, 0x9b, 0xe8, 0xfb, 0x7a,
+  0xbb, 0x19, 0xc9, 0x53, 0x22, 0xdf, 0xf1, 0xc2, 0x7f, 0x7d, 0xd9, 0xfc, 0x08, 0x40, 0xac, 0x68,
+  0x22, 0x78, 0x6a, 0x55, 0xa0, 0xf0, 0xdb, 0xeb, 0x36, 0x02, 0x19, 0x49, 0x12, 0xca, 0xe1, 0x2e,
+  0x42, 0xdf, 0xdf, 0x7e, 0x18, 0x81, 0xaa, 0x41, 0xa2, 0x14, 0x5e, 0x44, 0x6f, 0xdf, 0xb6, 0x6b,
+  0x04, 0x92, 0x23, 0x91, 0x9c, 0xf1, 0x1c, 0x2f, 0xb6, 0xdb, 0x37, 0x1f, 0xbd, 0x80, 0x24, 0x25,
+  0x3c, 0xa7, 0x12, 0x04, 0x51, 0x14, 0x86, 0xc6, 0xe0, 0x2e, 0xef, 0x6d, 0x05, 0x66, 0xb5, 0x92,
+  0x84, 0xc8, 0x14, 0x24, 0xd4, 0x2c, 0x90, 0x68, 0x7a, 0x02, 0x3b, 0x99, 0xfd, 0xeb, 0x3e, 0xc7,
+  0x1e, 0xed, 0x90, 0x59, 0xe6, 0xa6, 0x90, 0x29, 0x95, 0x9e, 0x24, 0x29, 0xab, 0x15, 0xf6, 0x83,
+  0xea, 0x64, 0xbc, 0x2a, 0x48, 0x2a, 0x8e, 0x18, 0x39, 0x3e, 0xaa, 0x4e, 0x4e, 0x60, 0xfe, 0xc9,
+  0x7c, 0x47, 0x9e, 0xd1, 0xd2, 0xae, 0x55, 0xe8, 0x1a, 0x95, 0x92, 0x70, 0xc5, 0x34, 0x13, 0x1c,
+  0x93, 0xb2, 0x74, 0x40, 0xaa, 0x1c, 0x4a, 0x14, 0x8d, 0x2f, 0xbf, 0x34, 0x90, 0x8f, 0x9c, 0x71,
+  0x8c, 0xe2, 0x8a, 0xa4, 0xa9, 0x89, 0x06, 0xc5, 0x3b, 0x71, 0xf2, 0x14, 0xfb, 0xd7, 0x7c, 0x74,
+  0x36, 0x41, 0x12, 0x5f, 0x76, 0x22, 0x3d, 0x37, 0x99, 0xe0, 0xda, 0xcb, 0xc8, 0x9e, 0x95, 0x67,
+  0xfc, 0xe5, 0x0f, 0x9a, 0x0b, 0xea, 0xfc, 0xf9, 0xfb, 0x97, 0xe5, 0x4f, 0x52, 0x88, 0x3d, 0x59,
+  0xfe, 0x46, 0x39, 0x3d, 0x90, 0xe5, 0x5f, 0x54, 0x42, 0x26, 0xc8, 0x52, 0x81, 0x59, 0x08, 0x45,
+  0xb2, 0x2c, 0xde, 0x91, 0xe4, 0x3d, 0x97, 0xa2, 0xe6, 0xa9, 0x97, 0x88, 0x52, 0x48, 0x7c, 0x20,
+  0xf2, 0x79, 0xc8, 0x8f, 0x1b, 0x8f, 0x85, 0x26, 0x03, 0x6e, 0xbc, 0x67, 0xdc, 0x2b, 0xa8, 0x2d,
+  0xa0, 0x8f, 0xd0, 0xa1, 0x88, 0x53, 0xa6, 0xaa, 0x92, 0x9c, 0x71, 0x56, 0xd2, 0x53, 0x6c, 0xfe,
+  0x79, 0x29, 0x93, 0x34, 0xb1, 0x61, 0xc1, 0xf5, 0x7a, 0xcf, 0x87, 0x18, 0x4c, 0x1e, 0x46, 0x26,
+  0x71, 0xc9, 0x38, 0x25, 0xd2, 0xcb, 0x4d, 0xee, 0xa0, 0xaa, 0xcf, 0x7e, 0xb8, 0x4e, 0x69, 0xbe,
+  0xec, 0xaa, 0xe2, 0xa0, 0xa7, 0xe5, 0x22, 0x20, 0x66, 0x41, 0x1a, 0xd1, 0x93, 0x1b, 0x5f, 0x56,
+  0x90, 0x7e, 0x4d, 0xe0, 0x96, 0x6c, 0x8e, 0x2c, 0xd5, 0x85, 0x71, 0xe1, 0x29, 0xde, 0x93, 0x93,
+  0xd7, 0x7e, 0x6e, 0x90, 0xb1, 0xd0, 0xe7, 0xce, 0x21, 0xb5, 0x16, 0x8f, 0xf8, 0x97, 0x93, 0xaa,
+  0xf5, 0x0d, 0x0c, 0x00, 0x08, 0x9a, 0x91, 0x8b, 0x43, 0x3e, 0xcc, 0x86, 0x1b, 0x4f, 0x8b, 0xdd,
+  0x6d, 0x8e, 0x65, 0x6e, 0x5b, 0xa6, 0xb6, 0xfc, 0xed, 0x7e, 0xfb, 0xe1, 0xc6, 0xe2, 0x40, 0x65,
+  0x56, 0x82, 0xb8, 0x60, 0x69, 0x4a, 0x79, 0x67, 0x0c, 0x92, 0x49, 0xe0, 0x7a, 0xf3, 0x71, 0x5a,
+  0x5a, 0x6d, 0x5d, 0xaf, 0xb8, 0x26, 0x3b, 0x13, 0x49, 0xdb, 0x55, 0x6e, 0x97, 0xaa, 0x49, 0xca,
+  0x2d, 0x76, 0x09, 0xec, 0x43, 0xc4, 0xa0, 0x90, 0xca, 0xa9, 0x6d, 0xa7, 0xf0, 0x5b, 0x00, 0x01,
+  0xba, 0x28, 0x0e, 0x22, 0xb8, 0x61, 0x3f, 0x8f, 0x6d, 0x99, 0x21, 0xa9, 0x5d, 0x4a, 0x21, 0x54,
+  0xad, 0xc5, 0x1e, 0x7f, 0xed, 0x75, 0x0e, 0x30, 0x07, 0xd4, 0x3b, 0xeb, 0x39, 0xc8, 0x03, 0x77,
+  0x66, 0xa7, 0x6a, 0x44, 0x45, 0x12, 0xa6, 0xcf, 0x18, 0xad, 0x5e, 0xe3, 0xab, 0x49, 0x3f, 0x1a,
+  0x72, 0xef, 0x99, 0x0a, 0x83, 0x8f, 0xcd, 0x24, 0x80, 0xcb, 0x4a, 0x69, 0xa2, 0x6b, 0xe5, 0x5d,
+  0xeb, 0x3f, 0xca, 0xd7, 0xc2, 0x27, 0x66, 0x3d, 0x52, 0x9c, 0x5e, 0xab, 0xbf, 0x1e, 0x70, 0xd2,
+  0x07, 0x35, 0x35, 0xc4, 0x34, 0xdd, 0x37, 0x13, 0xe8, 0xfc, 0x53, 0x2b, 0xcd, 0xb2, 0x73, 0xef,
+  0x20, 0x56, 0x10, 0x0a, 0xf5, 0x76, 0x54, 0x1f, 0x29, 0x14, 0x73, 0xaa, 0xcb, 0x74, 0xfd, 0x6d,
+  0x7c, 0x23, 0xd5, 0xb8, 0x24, 0x4a, 0x7b, 0x49, 0xc1, 0xca, 0xb4, 0x99, 0x5e, 0x45, 0xd7, 0x83,
+  0x25, 0xd9, 0xd1, 0xb2, 0x99, 0xb7, 0xe0, 0x95, 0x84, 0xdc, 0xeb, 0xd1, 0x03, 0x29, 0x6b, 0xda,
+  0x8c, 0xab, 0xb6, 0x46, 0x46, 0x53, 0x26, 0xe4, 0xde, 0x93, 0xe2, 0xd8, 0xdc, 0x8d, 0xd5, 0xee,
+  0xb6, 0x56, 0xfa, 0x50, 0x77, 0xa5, 0x48, 0xde, 0xef, 0x94, 0x7b, 0x16, 0xcc, 0xff, 0x3b, 0x65,
+  0xf5, 0x32, 0x5e, 0xd5, 0x7a, 0xdc, 0xa6, 0x43, 0xee, 0x83, 0x29, 0x0b, 0x74, 0x3d, 0xde, 0x95,
+  0x0f, 0xfb, 0x00, 0x23, 0x25, 0x4a, 0x96, 0x3a, 0x8b, 0x28, 0x8a, 0x1e, 0x29, 0xea, 0x2d, 0x49,
+  0x8d, 0xbc, 0xdd, 0xd8, 0x48, 0x77, 0x35, 0x44, 0xc2, 0x67, 0x51, 0xde, 0xf3, 0x6d, 0xfd, 0x10,
+  0x43, 0x7d, 0xaa, 0x15, 0x5b, 0xf7, 0x8e, 0x05, 0xd4, 0xbd, 0x8f, 0x91, 0x0b, 0x4e, 0x1f, 0x89,
+  0x6c, 0x16, 0xc7, 0xbc, 0x2b, 0x93, 0x5a, 0x2a, 0x50, 0x5d, 0x09, 0x66, 0x9b, 0x7a, 0xf4, 0x9e,
+  0x74, 0xc9, 0x18, 0x04, 0x6e, 0xdb, 0xaf, 0x56, 0x60, 0xaa, 0x83, 0xeb, 0xaa, 0xa2, 0x32, 0x31,
+  0x8f, 0x4d, 0x49, 0x35, 0x5c, 0xf6, 0x0c, 0x9c, 0x6d, 0x06, 0xee, 0xf2, 0x85, 0x95, 0xa4, 0x50,
+  0x63, 0x49, 0xac, 0x7e, 0x1b, 0x40, 0x87, 0x12, 0x2d, 0x06, 0xf6, 0x6c, 0xd3, 0x8c, 0x0b, 0x43,
+  0x75, 0xcd, 0xd5, 0x98, 0xfd, 0x55, 0x12, 0x4d, 0xff, 0x7e, 0xf6, 0xc2, 0xea, 0x34, 0xe1, 0x48,
+  0xe4, 0x7c, 0x9d, 0xbc, 0x90, 0x61, 0xb8, 0xf4, 0xd7, 0x68, 0x19, 0x44, 0x21, 0x30, 0x48, 0xe4,
+  0x0e, 0x4a, 0xbb, 0x47, 0xfc, 0x61, 0x9e, 0x6c, 0x8f, 0xdb, 0xda, 0xc0, 0x20, 0xf0, 0x82, 0xa2,
+  0x70, 0x78, 0x44, 0x32, 0x98, 0x4f, 0x8c, 0x7f, 0x37, 0x51, 0x8e, 0x51, 0xe0, 0xa0, 0x71, 0x7c,
+  0xe1, 0xac, 0xa1, 0x83, 0x8f, 0x7a, 0x80, 0xf4, 0x6e, 0x1b, 0x7f, 0x07, 0xdc, 0x31, 0x6e, 0x7c,
+  0xf6, 0x5a, 0xf8, 0x0d, 0xd6, 0xfa, 0x11, 0xe1, 0x1e, 0x21, 0x8d, 0xfb, 0x24, 0x0c, 0xc3, 0x09,
+  0x98, 0xee, 0x16, 0xe5, 0x73, 0xa8, 0xb2, 0xc4, 0x34, 0xf1, 0xb5, 0x2b, 0xde, 0xd8, 0xae, 0x69,
+  0xc3, 0xcb, 0x8a, 0x03, 0xd3, 0x09, 0xf9, 0x0e, 0xd8, 0x56, 0xfa, 0x3e, 0x9d, 0xf4, 0x27, 0x6e,
+  0xb9, 0xd3, 0x66, 0xd9, 0xca, 0xd5, 0x4d, 0xae, 0xe7, 0x6c, 0xf0, 0x38, 0x99, 0xdf, 0xb2, 0xd4,
+  0x67, 0x1a, 0x62, 0xea, 0xef, 0x9d, 0xb0, 0x83, 0xb5, 0x59, 0xb3, 0x73, 0x2b, 0x45, 0x4b, 0x18,
+  0x1e, 0x68, 0x3a, 0x3b, 0x1a, 0x92, 0x28, 0xbb, 0x65, 0xb0, 0x29, 0x4f, 0x8c, 0x55, 0xf1, 0x4c,
+  0x34, 0x26, 0x35, 0xd8, 0x1f, 0x49, 0x39, 0xd9, 0xd3, 0xd1, 0x4b, 0x6c, 0xc9, 0xe8, 0x96, 0xd3,
+  0xfb, 0xd3, 0x29, 0x85, 0xa7, 0xb0, 0x54, 0x1f, 0x66, 0xfa, 0x13, 0xb0, 0x1d, 0x23, 0xbe, 0x7d,
+  0xb2, 0x40, 0x1b, 0x29, 0x3d, 0xa5, 0x25, 0xe5, 0xb9, 0x2e, 0xa6, 0xb6, 0xba, 0xd3, 0xb2, 0x1b,
+  0x06, 0xc7, 0x17, 0x76, 0xa4, 0x9f, 0xd0, 0xc2, 0x6a, 0x76, 0x70, 0x56, 0xef, 0x7b, 0xc4, 0x39,
+  0x2b, 0xbe, 0x3f, 0xd3, 0xbc, 0x22, 0x30, 0xbd, 0x1d, 0xe8, 0x30, 0x4c, 0xf8, 0xd3, 0x5d, 0xc6,
+  0x67, 0xfb, 0x30, 0x58, 0x9b, 0x13, 0x14, 0xd0, 0x01, 0x9f, 0x1e, 0x83, 0x70, 0x7b, 0x00, 0x97,
+  0x34, 0xd3, 0xd8, 0x8e, 0x89, 0xdd, 0x63, 0x60, 0x68, 0xb6, 0x1f, 0x6f, 0xcd, 0xef, 0x8f, 0x92,
+  0x3b, 0x9f, 0x0a, 0x86, 0xf9, 0x4a, 0x55, 0x8c, 0x5f, 0xe7, 0x54, 0xdb, 0x21, 0x9d, 0xde, 0xb6,
+  0xaf, 0x5b, 0xa8, 0x04, 0x03, 0x54, 0x6e, 0xc9, 0x2f, 0x9c, 0xe7, 0x61, 0x0d, 0x0f, 0x55, 0x27,
+  0x81, 0x0a, 0x4d, 0x06, 0xf6, 0x01, 0x62, 0x84, 0xc3, 0x0f, 0x8b, 0x78, 0xe3, 0x80, 0xe3, 0x2b,
+  0xa7, 0x65, 0x49, 0x07, 0x10, 0xc7, 0xb8, 0x61, 0x8d, 0x3b, 0x55, 0xfb, 0xf5, 0x9d, 0x9e, 0x33,
+  0x09, 0xe0, 0x53, 0x8e, 0xb9, 0xd5, 0x68, 0x31, 0x22, 0x6f, 0x29, 0x60, 0xc4, 0xa0, 0xcf, 0xe1,
+  0x06, 0x01, 0xb9, 0x02, 0x86, 0x2f, 0xff, 0x01, 0x35, 0x38, 0x19, 0xa5, 0xe0, 0x0d, 0x00, 0x00
+};
+
+// /assets/network.63c4400b71fe5ca2.js: 2731 bytes, 1054 gzipped
+static const uint8_t NETWORK_JS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x56, 0x5f, 0x6f, 0xdb, 0x36,
+  0x10, 0x7f, 0xd7, 0xa7, 0x20, 0xbc, 0x00, 0x92, 0x97, 0x5a, 0x76, 0xda, 0x65, 0x1b, 0x2c, 0xcb,
+  0x45, 0x9b, 0x79, 0x6d, 0x80, 0x36, 0x1d, 0xe0, 0x60, 0xcf, 0xe1, 0xa4, 0xb3, 0xcd, 0x96, 0x26,
+  0x35, 0x92, 0xf2, 0x6c, 0x04, 0xfe, 0x12, 0xdd, 0xde, 0xf7, 0x15, 0xf7, 0x11, 0x76, 0xa4, 0x28,
+  0x59, 0xb2, 0x9d, 0x3c, 0x0c, 0x33, 0x60, 0x80, 0xe2, 0xfd, 0x78, 0xf7, 0xbb, 0xe3, 0xfd, 0x61,
+  0x2e, 0xb3, 0x72, 0x0d, 0xc2, 0xc4, 0x34, 0xcf, 0x67, 0x1b, 0x5c, 0x7c, 0x60, 0xda, 0x80, 0x00,
+  0x15, 0x85, 0x3f, 0x7d, 0xfa, 0x78, 0x23, 0x85, 0xb1, 0x7b, 0x92, 0xe6, 0x90, 0x87, 0x2f, 0xc8,
+  0xa2, 0x14, 0x99, 0x61, 0x52, 0x44, 0x7d, 0xf2, 0x18, 0xe8, 0x8c, 0x8a, 0x3b, 0x30, 0x7f, 0x48,
+  0xf5, 0x45, 0x47, 0xfd, 0x24, 0xd8, 0xe3, 0xbf, 0x06, 0x90, 0x8e, 0x50, 0xc1, 0x42, 0x81, 0x5e,
+  0xd9, 0x43, 0x99, 0x14, 0xda, 0x10, 0x51, 0x49, 0xac, 0x2d, 0x92, 0x92, 0xbc, 0xe6, 0xb0, 0x04,
+  0x33, 0xe3, 0x60, 0x97, 0x6f, 0x77, 0xb7, 0x79, 0x14, 0xb6, 0x60, 0xa1, 0x55, 0x0e, 0x26, 0x5b,
+  0xd5, 0xca, 0xc8, 0x6b, 0x12, 0x0e, 0xad, 0x15, 0x0f, 0xd2, 0xaf, 0xbd, 0x20, 0xbd, 0x0a, 0xc9,
+  0xf8, 0x48, 0x16, 0xf6, 0x83, 0xd8, 0xac, 0x40, 0xe0, 0x61, 0x5d, 0x20, 0x03, 0x20, 0xe9, 0x94,
+  0xd4, 0xeb, 0xf8, 0xb3, 0xb6, 0x1e, 0xd5, 0x90, 0x9c, 0x1a, 0x6a, 0xc5, 0x47, 0x5c, 0xb5, 0x25,
+  0x8a, 0xa2, 0xb8, 0xfe, 0x4e, 0x02, 0xb6, 0x20, 0x0e, 0x1d, 0x3b, 0x53, 0x4c, 0x2c, 0x5d, 0x54,
+  0xc0, 0xdc, 0xb3, 0x35, 0xc8, 0xd2, 0x44, 0xed, 0x18, 0xbc, 0x20, 0x57, 0xd7, 0xa3, 0x91, 0x8d,
+  0x92, 0x3b, 0x56, 0x2b, 0x89, 0x39, 0x88, 0xa5, 0x59, 0x91, 0x34, 0x4d, 0xc9, 0xc8, 0x1e, 0x3f,
+  0xab, 0xb3, 0x15, 0x87, 0x98, 0xa1, 0x53, 0xea, 0xfd, 0xfd, 0xc7, 0x0f, 0xc8, 0x27, 0x9c, 0xe4,
+  0x6c, 0x43, 0xb4, 0xd9, 0x71, 0x48, 0x7b, 0x39, 0xd3, 0x05, 0xa7, 0xbb, 0xf1, 0x82, 0xc3, 0x36,
+  0x21, 0x94, 0xb3, 0xa5, 0x18, 0x30, 0x03, 0x6b, 0x3d, 0xce, 0x30, 0xa0, 0xa0, 0x12, 0xf2, 0xb9,
+  0xd4, 0x86, 0x2d, 0x76, 0x83, 0xac, 0xba, 0xd5, 0x66, 0xbf, 0xc0, 0xbb, 0x47, 0x4b, 0xe3, 0x97,
+  0xa3, 0x62, 0x9b, 0xf4, 0xa6, 0x4e, 0x69, 0xc6, 0xa9, 0xd6, 0x69, 0x4f, 0x17, 0xce, 0x1e, 0x6e,
+  0x0e, 0x71, 0x77, 0x3a, 0xd1, 0x05, 0x15, 0xd3, 0xb9, 0xa7, 0x46, 0x16, 0x52, 0x35, 0xe1, 0x89,
+  0xe3, 0x78, 0x32, 0x74, 0xe2, 0x0a, 0x1a, 0xa2, 0xab, 0x04, 0x38, 0x86, 0xfa, 0x39, 0xfe, 0xc5,
+  0xf4, 0x4e, 0x1e, 0x22, 0xbc, 0x90, 0xa5, 0xc8, 0x63, 0x32, 0xa1, 0x64, 0x85, 0x97, 0x99, 0xf6,
+  0xbe, 0xe9, 0x11, 0x29, 0x32, 0xce, 0xb2, 0x2f, 0xc8, 0xa4, 0x9d, 0x50, 0x46, 0x95, 0xd0, 0x4f,
+  0xf0, 0x06, 0x4d, 0xa9, 0x04, 0x59, 0x50, 0x34, 0x83, 0xc4, 0x2d, 0x2f, 0x42, 0x97, 0x94, 0x89,
+  0xc9, 0x90, 0x22, 0x8d, 0xc2, 0x91, 0x08, 0x2a, 0x94, 0x5d, 0x3d, 0xc9, 0x03, 0x71, 0x8d, 0x1f,
+  0xe8, 0xd4, 0x8c, 0x62, 0x9e, 0xf9, 0x8d, 0x33, 0xa9, 0x70, 0x8b, 0x51, 0x6d, 0xa7, 0x6d, 0xa6,
+  0x80, 0x1a, 0xf0, 0x99, 0x1b, 0x85, 0xe8, 0xbd, 0xcd, 0xd6, 0x16, 0x38, 0x76, 0xd1, 0xbc, 0xa3,
+  0x6b, 0xb0, 0xc6, 0xbc, 0xc0, 0x5d, 0x4e, 0xd8, 0xc5, 0x79, 0x6f, 0x11, 0xd5, 0xad, 0x34, 0xe0,
+  0x90, 0x19, 0xef, 0x7d, 0x4d, 0x2c, 0xd6, 0x9a, 0xe5, 0x36, 0xa1, 0x12, 0xcf, 0x4e, 0xe3, 0x8d,
+  0x53, 0x3e, 0x37, 0xca, 0xa7, 0x14, 0xc9, 0x28, 0xcf, 0x4a, 0x8e, 0xd4, 0xe6, 0x1d, 0x49, 0xa3,
+  0x40, 0xa1, 0x86, 0x23, 0xa2, 0xed, 0xa8, 0x3c, 0x04, 0xed, 0x4c, 0x68, 0x58, 0x8b, 0x85, 0xec,
+  0x4d, 0xcf, 0x8a, 0x04, 0x3a, 0xd8, 0x9b, 0x5e, 0x3c, 0xb6, 0x09, 0xee, 0xab, 0x6c, 0x38, 0x8b,
+  0xcf, 0xc1, 0x50, 0xc6, 0xf5, 0x91, 0xb6, 0xca, 0x8d, 0x81, 0xf6, 0x6c, 0x51, 0x7a, 0xf1, 0xb8,
+  0xb4, 0x1d, 0xa9, 0x71, 0xe4, 0x2d, 0x55, 0x3a, 0xea, 0x7a, 0xdb, 0xdf, 0x07, 0xb5, 0x21, 0x97,
+  0x83, 0x2d, 0x12, 0x90, 0x95, 0x0a, 0x6c, 0xb7, 0x98, 0xbb, 0x95, 0x6b, 0x0e, 0x9f, 0x0a, 0x10,
+  0xe1, 0xde, 0xe7, 0x6b, 0x73, 0xf2, 0x94, 0xa9, 0x3b, 0xcc, 0xcc, 0x6e, 0xc0, 0x30, 0xc4, 0x8e,
+  0xc9, 0xa9, 0xda, 0xca, 0xe0, 0x3f, 0x7f, 0xff, 0xf5, 0xd5, 0xeb, 0x73, 0x16, 0x9a, 0xdd, 0x3f,
+  0xeb, 0xdd, 0x86, 0xe1, 0x43, 0xd2, 0x49, 0x44, 0x5a, 0x20, 0x99, 0xfc, 0x66, 0xc5, 0x78, 0x1e,
+  0xb5, 0xae, 0xc2, 0x37, 0x54, 0x7f, 0xb5, 0x98, 0xd9, 0xb7, 0x18, 0xf8, 0x67, 0xb2, 0xae, 0xb0,
+  0x39, 0x57, 0xe3, 0xba, 0xf7, 0xe8, 0xea, 0x15, 0x72, 0x72, 0xf1, 0xd8, 0x74, 0x96, 0x37, 0x4b,
+  0xd8, 0x6b, 0xac, 0x15, 0xf9, 0x7f, 0x55, 0xdb, 0x33, 0x4e, 0xd5, 0xa4, 0x9c, 0x47, 0x41, 0x9c,
+  0x51, 0xdb, 0xc5, 0x41, 0x29, 0x6c, 0x1e, 0x4d, 0x6d, 0x49, 0x0e, 0xb1, 0xdb, 0x8a, 0xc2, 0x99,
+  0x93, 0xd4, 0xed, 0xaf, 0x69, 0x0e, 0x63, 0x1c, 0x3f, 0x0e, 0xd1, 0x4f, 0x9e, 0xed, 0x27, 0x4f,
+  0x1c, 0xff, 0xef, 0x7e, 0xde, 0xab, 0xdd, 0x69, 0x53, 0x71, 0x8d, 0xbc, 0x19, 0x76, 0x4f, 0x15,
+  0x9a, 0x2b, 0x30, 0xdf, 0xd4, 0xed, 0x9a, 0x4c, 0x53, 0x32, 0xb8, 0xc6, 0x3e, 0xef, 0x4d, 0x7c,
+  0x97, 0x10, 0xf7, 0x1b, 0x0e, 0xc9, 0x6c, 0x9b, 0x01, 0xc7, 0x61, 0x60, 0x02, 0xd7, 0x33, 0x3b,
+  0x27, 0xbe, 0x3f, 0x9c, 0x78, 0x95, 0x58, 0xf0, 0x3b, 0x29, 0xf3, 0x33, 0xb8, 0x1f, 0x0e, 0xb8,
+  0x97, 0x0e, 0xf7, 0x33, 0x65, 0xea, 0x0c, 0xee, 0xc7, 0x03, 0xee, 0xca, 0xe1, 0x7e, 0x91, 0xd2,
+  0xe3, 0xfc, 0xf6, 0xc8, 0x13, 0x6b, 0xff, 0x10, 0xf7, 0x2b, 0x60, 0x2c, 0x0a, 0x0b, 0x6e, 0x39,
+  0x7f, 0xae, 0x36, 0xeb, 0xaa, 0x44, 0xdf, 0x39, 0x18, 0xf2, 0x1b, 0x6e, 0xfa, 0x36, 0x6b, 0x47,
+  0x46, 0x64, 0xf7, 0x18, 0x6e, 0xa0, 0x19, 0x46, 0x26, 0x36, 0x0c, 0xec, 0xf2, 0xf2, 0xf0, 0x3a,
+  0x40, 0xf8, 0x7b, 0x60, 0xcb, 0x95, 0x7d, 0x1b, 0x5c, 0x93, 0x4b, 0x12, 0x31, 0xf2, 0x2d, 0x79,
+  0xd5, 0x14, 0x03, 0x8a, 0x6f, 0x6c, 0x79, 0xa2, 0xd4, 0x9e, 0xae, 0x8d, 0xd9, 0x5a, 0xa4, 0x48,
+  0x69, 0x53, 0x95, 0x38, 0x13, 0xfe, 0x23, 0x09, 0x9c, 0xf9, 0x4b, 0x2c, 0x84, 0x33, 0x6d, 0x06,
+  0x65, 0x58, 0x17, 0xb5, 0xca, 0x7d, 0xaf, 0x9e, 0xa6, 0x2b, 0x47, 0x60, 0x5c, 0xc9, 0x2a, 0x36,
+  0xfb, 0x62, 0x5b, 0xcf, 0xc1, 0x87, 0xc3, 0x5c, 0x71, 0xce, 0x75, 0xb2, 0xa1, 0xdb, 0xad, 0x5d,
+  0x97, 0x46, 0xd7, 0x9e, 0x7c, 0xe4, 0x58, 0x40, 0xd8, 0x8f, 0x37, 0x94, 0x97, 0x76, 0x3c, 0xd8,
+  0xcf, 0xe4, 0x74, 0xde, 0xe8, 0x76, 0xe9, 0xff, 0x5e, 0xe2, 0x45, 0xcc, 0x9d, 0x19, 0xa9, 0xde,
+  0x70, 0x1e, 0x85, 0x71, 0x67, 0xa8, 0x74, 0x9b, 0xfa, 0x61, 0xa4, 0x31, 0x37, 0xb8, 0x4e, 0xe6,
+  0x99, 0x1f, 0x4c, 0x56, 0xda, 0x55, 0xdd, 0xd2, 0x6b, 0x7b, 0x3b, 0xb2, 0x34, 0xb0, 0x35, 0xfe,
+  0x51, 0x98, 0xb4, 0x1f, 0x32, 0x95, 0x8a, 0xb4, 0xa2, 0xef, 0x52, 0xbe, 0x19, 0x7b, 0x55, 0x3f,
+  0xc8, 0xad, 0xa7, 0x4e, 0x2d, 0x3e, 0x24, 0xfb, 0xad, 0xb7, 0xc1, 0x11, 0x50, 0xc1, 0x5a, 0x6e,
+  0xe0, 0x08, 0x5b, 0xd5, 0xdb, 0xbf, 0x4b, 0x6a, 0xc3, 0xc0, 0xab, 0x0a, 0x00, 0x00
+};
+
+// /network template: 2826 bytes, {{FIELD}} placeholders filled in when served
+static const uint8_t NETWORK_TEMPLATE[] PROGMEM = {
+  0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+  0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x3d, 0x22, 0x65, 0x6e, 0x22, 0x3e,
+  0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x4e,
+  0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20,
+  0x2d, 0x20, 0x41, 0x71, 0x75, 0x61, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x3c, 0x2f, 0x74, 0x69, 0x74,
+  0x6c, 0x65, 0x3e, 0x0a, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x27,
+  0x76, 0x69, 0x65, 0x77, 0x70, 0x6f, 0x72, 0x74, 0x27, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
+  0x74, 0x3d, 0x27, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d,
+  0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d, 0x73,
+  0x63, 0x61, 0x6c, 0x65, 0x3d, 0x31, 0x27, 0x3e, 0x0a, 0x3c, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x72,
+  0x65, 0x6c, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x20,
+  0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x61, 0x73, 0x73, 0x65, 0x74, 0x73, 0x2f, 0x6e, 0x65,
+  0x74, 0x77, 0x6f, 0x72, 0x6b, 0x2e, 0x30, 0x35, 0x36, 0x31, 0x36, 0x30, 0x64, 0x31, 0x31, 0x39,
+  0x34, 0x31, 0x65, 0x66, 0x63, 0x33, 0x2e, 0x63, 0x73, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x2f, 0x68,
+  0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76,
+  0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65,
+  0x72, 0x22, 0x3e, 0x0a, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x22, 0x20,
+  0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2d, 0x62, 0x61,
+  0x63, 0x6b, 0x22, 0x3e, 0x26, 0x6c, 0x61, 0x72, 0x72, 0x3b, 0x42, 0x61, 0x63, 0x6b, 0x20, 0x74,
+  0x6f, 0x20, 0x44, 0x61, 0x73, 0x68, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x3c, 0x2f, 0x61, 0x3e, 0x0a,
+  0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x61, 0x72, 0x64,
+  0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63,
+  0x61, 0x72, 0x64, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x22, 0x3e, 0x0a, 0x3c, 0x68, 0x31,
+  0x3e, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67,
+  0x73, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x0a, 0x3c, 0x70, 0x3e, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67,
+  0x75, 0x72, 0x65, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x70, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c,
+  0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x61, 0x72, 0x64, 0x2d,
+  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x63, 0x6f, 0x6e,
+  0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c,
+  0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x69, 0x74, 0x65, 0x6d,
+  0x22, 0x3e, 0x0a, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+  0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0x43, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x4d, 0x6f, 0x64, 0x65, 0x3a, 0x3c, 0x2f, 0x73, 0x70, 0x61,
+  0x6e, 0x3e, 0x0a, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+  0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x20, 0x69, 0x64,
+  0x3d, 0x22, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x4d, 0x6f, 0x64, 0x65, 0x22, 0x3e, 0x7b,
+  0x7b, 0x4d, 0x4f, 0x44, 0x45, 0x7d, 0x7d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x0a, 0x3c,
+  0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+  0x3d, 0x22, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x22, 0x3e, 0x0a,
+  0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x61,
+  0x74, 0x75, 0x73, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0x49, 0x50, 0x20, 0x41, 0x64,
+  0x64, 0x72, 0x65, 0x73, 0x73, 0x3a, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x0a, 0x3c, 0x73,
+  0x70, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x61, 0x74, 0x75,
+  0x73, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x69, 0x70, 0x41,
+  0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x22, 0x3e, 0x7b, 0x7b, 0x49, 0x50, 0x5f, 0x41, 0x44, 0x44,
+  0x52, 0x45, 0x53, 0x53, 0x7d, 0x7d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x0a, 0x3c, 0x2f,
+  0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76,
+  0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x2d,
+  0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x3e, 0x0a, 0x3c, 0x68, 0x33, 0x3e, 0x41, 0x76,
+  0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73,
+  0x3c, 0x2f, 0x68, 0x33, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+  0x3d, 0x22, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x22, 0x20,
+  0x69, 0x64, 0x3d, 0x22, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x4c, 0x69, 0x73, 0x74, 0x22,
+  0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x64, 0x69,
+  0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x20, 0x61, 0x6c, 0x69, 0x67,
+  0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x20,
+  0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
+  0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a,
+  0x32, 0x30, 0x70, 0x78, 0x3b, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61,
+  0x73, 0x73, 0x3d, 0x22, 0x73, 0x70, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x22, 0x3e, 0x3c, 0x2f, 0x64,
+  0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x53, 0x63, 0x61, 0x6e, 0x6e, 0x69,
+  0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x2e,
+  0x2e, 0x2e, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+  0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c,
+  0x66, 0x6f, 0x72, 0x6d, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x2f, 0x6e, 0x65,
+  0x74, 0x77, 0x6f, 0x72, 0x6b, 0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x47,
+  0x45, 0x54, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x46, 0x6f, 0x72, 0x6d,
+  0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66,
+  0x6f, 0x72, 0x6d, 0x2d, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c,
+  0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x73, 0x73, 0x69, 0x64, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73,
+  0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0x57,
+  0x69, 0x46, 0x69, 0x20, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x4e, 0x61, 0x6d, 0x65,
+  0x20, 0x28, 0x53, 0x53, 0x49, 0x44, 0x29, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a,
+  0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78,
+  0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x73, 0x69, 0x64, 0x22, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x73, 0x73, 0x69, 0x64, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+  0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x20, 0x72, 0x65, 0x71, 0x75,
+  0x69, 0x72, 0x65, 0x64, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69,
+  0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x72, 0x6f,
+  0x77, 0x22, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22,
+  0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+  0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0x57, 0x69, 0x46,
+  0x69, 0x20, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65,
+  0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22,
+  0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x61,
+  0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x70, 0x61,
+  0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66,
+  0x6f, 0x72, 0x6d, 0x2d, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69,
+  0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66,
+  0x6f, 0x72, 0x6d, 0x2d, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c,
+  0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x4e, 0x61, 0x6d, 0x65,
+  0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x6c, 0x61,
+  0x62, 0x65, 0x6c, 0x22, 0x3e, 0x44, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x4e, 0x61, 0x6d, 0x65,
+  0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20,
+  0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22,
+  0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x4e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x4e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x63, 0x6c,
+  0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x22,
+  0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+  0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f,
+  0x72, 0x6d, 0x2d, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20,
+  0x66, 0x6f, 0x72, 0x3d, 0x22, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x50, 0x22, 0x20, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c,
+  0x22, 0x3e, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x49, 0x50, 0x20, 0x28, 0x6f, 0x70, 0x74,
+  0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x2c, 0x20, 0x6c, 0x65, 0x61, 0x76, 0x65, 0x20, 0x65, 0x6d, 0x70,
+  0x74, 0x79, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x44, 0x48, 0x43, 0x50, 0x29, 0x3c, 0x2f, 0x6c, 0x61,
+  0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65,
+  0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x74, 0x61, 0x74,
+  0x69, 0x63, 0x49, 0x50, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x74, 0x61, 0x74,
+  0x69, 0x63, 0x49, 0x50, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72,
+  0x6d, 0x2d, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f,
+  0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x31, 0x39, 0x32, 0x2e, 0x31, 0x36, 0x38, 0x2e, 0x31, 0x2e,
+  0x35, 0x30, 0x22, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76,
+  0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x72, 0x6f, 0x77,
+  0x22, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x67,
+  0x61, 0x74, 0x65, 0x77, 0x61, 0x79, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66,
+  0x6f, 0x72, 0x6d, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0x47, 0x61, 0x74, 0x65, 0x77,
+  0x61, 0x79, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75,
+  0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64,
+  0x3d, 0x22, 0x67, 0x61, 0x74, 0x65, 0x77, 0x61, 0x79, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x67, 0x61, 0x74, 0x65, 0x77, 0x61, 0x79, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+  0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x20, 0x70, 0x6c, 0x61,
+  0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x31, 0x39, 0x32, 0x2e, 0x31, 0x36,
+  0x38, 0x2e, 0x31, 0x2e, 0x31, 0x22, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c,
+  0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d,
+  0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72,
+  0x3d, 0x22, 0x73, 0x75, 0x62, 0x6e, 0x65, 0x74, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+  0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0x53, 0x75, 0x62,
+  0x6e, 0x65, 0x74, 0x20, 0x4d, 0x61, 0x73, 0x6b, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e,
+  0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65,
+  0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6e, 0x65, 0x74, 0x22, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6e, 0x65, 0x74, 0x22, 0x20, 0x63, 0x6c,
+  0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x22,
+  0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x32, 0x35,
+  0x35, 0x2e, 0x32, 0x35, 0x35, 0x2e, 0x32, 0x35, 0x35, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x3c, 0x2f,
+  0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+  0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62,
+  0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x64, 0x6e, 0x73, 0x22, 0x20, 0x63, 0x6c, 0x61,
+  0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e,
+  0x44, 0x4e, 0x53, 0x20, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65,
+  0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22,
+  0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x64, 0x6e, 0x73, 0x22, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x6e, 0x73, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+  0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x20, 0x70, 0x6c, 0x61,
+  0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x31, 0x39, 0x32, 0x2e, 0x31, 0x36,
+  0x38, 0x2e, 0x31, 0x2e, 0x31, 0x22, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c,
+  0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62,
+  0x6d, 0x69, 0x74, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x75, 0x74, 0x74,
+  0x6f, 0x6e, 0x22, 0x3e, 0x53, 0x61, 0x76, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x43, 0x6f, 0x6e,
+  0x6e, 0x65, 0x63, 0x74, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x2f,
+  0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x0a, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f,
+  0x72, 0x65, 0x73, 0x65, 0x74, 0x77, 0x69, 0x66, 0x69, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+  0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2d,
+  0x64, 0x61, 0x6e, 0x67, 0x65, 0x72, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x3d,
+  0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x28,
+  0x27, 0x41, 0x72, 0x65, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x79, 0x6f,
+  0x75, 0x20, 0x77, 0x61, 0x6e, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x20,
+  0x61, 0x6c, 0x6c, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x73, 0x65, 0x74, 0x74,
+  0x69, 0x6e, 0x67, 0x73, 0x3f, 0x20, 0x54, 0x68, 0x65, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65,
+  0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x69, 0x6e,
+  0x20, 0x41, 0x50, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x2e, 0x27, 0x29, 0x22, 0x3e, 0x52, 0x65, 0x73,
+  0x65, 0x74, 0x20, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69,
+  0x6e, 0x67, 0x73, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c,
+  0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69,
+  0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x6f, 0x74, 0x65, 0x72, 0x22,
+  0x3e, 0x0a, 0x3c, 0x70, 0x3e, 0x41, 0x71, 0x75, 0x61, 0x4c, 0x65, 0x76, 0x65, 0x6c, 0x20, 0x76,
+  0x31, 0x2e, 0x30, 0x20, 0x7c, 0x20, 0x45, 0x53, 0x50, 0x33, 0x32, 0x20, 0x2b, 0x20, 0x55, 0x6c,
+  0x74, 0x72, 0x61, 0x73, 0x6f, 0x6e, 0x69, 0x63, 0x20, 0x53, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20,
+  0x7c, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0xc2, 0xa9, 0x20, 0x32,
+  0x30, 0x32, 0x35, 0x3c, 0x2f, 0x70, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3d, 0x22, 0x2f, 0x61, 0x73, 0x73,
+  0x65, 0x74, 0x73, 0x2f, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x2e, 0x36, 0x33, 0x63, 0x34,
+  0x34, 0x30, 0x30, 0x62, 0x37, 0x31, 0x66, 0x65, 0x35, 0x63, 0x61, 0x32, 0x2e, 0x6a, 0x73, 0x22,
+  0x3e, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x62, 0x6f, 0x64,
+  0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e
+};
+static const size_t NETWORK_TEMPLATE_LENGTH = sizeof(NETWORK_TEMPLATE);
+
+static const WebAsset WEB_ASSETS[] = {
+  {"/assets/index.913fc79973b7a09e.css", "text/css", INDEX_CSS_GZ, sizeof(INDEX_CSS_GZ), "\"913fc79973b7a09e\"", "public, max-age=31536000, immutable"},
+  {"/assets/index.eba0cf7099ff4615.js", "application/javascript", INDEX_JS_GZ, sizeof(INDEX_JS_GZ), "\"eba0cf7099ff4615\"", "public, max-age=31536000, immutable"},
+  {"/", "text/html", INDEX_HTML_GZ, sizeof(INDEX_HTML_GZ), "\"32b8575c4f11d944\"", "no-cache"},
+  {"/assets/settings.3f22e7ef9f656ceb.css", "text/css", SETTINGS_CSS_GZ, sizeof(SETTINGS_CSS_GZ), "\"3f22e7ef9f656ceb\"", "public, max-age=31536000, immutable"},
+  {"/assets/settings.4e1b36d82b086514.js", "application/javascript", SETTINGS_JS_GZ, sizeof(SETTINGS_JS_GZ), "\"4e1b36d82b086514\"", "public, max-age=31536000, immutable"},
+  {"/settings.html", "text/html", SETTINGS_HTML_GZ, sizeof(SETTINGS_HTML_GZ), "\"aadc0a5ce21ca523\"", "no-cache"},
+  {"/assets/network.056160d11941efc3.css", "text/css", NETWORK_CSS_GZ, sizeof(NETWORK_CSS_GZ), "\"056160d11941efc3\"", "public, max-age=31536000, immutable"},
+  {"/assets/network.63c4400b71fe5ca2.js", "application/javascript", NETWORK_JS_GZ, sizeof(NETWORK_JS_GZ), "\"63c4400b71fe5ca2\"", "public, max-age=31536000, immutable"},
+};
+static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
+
+#endif // WEB_ASSETS_H
\ No newline at end of file
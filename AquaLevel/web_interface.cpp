@@ -1,4 +1,6 @@
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
+#include <freertos/semphr.h>
+#include <memory>
 #include "config.h"
 #include "web_interface.h"
 #include "eeprom_manager.h"
@@ -6,22 +8,339 @@
 #include "wifi_manager.h"
 #include "tank_calculator.h"
 #include "sensor_manager.h" 
+#include "median_filter.h"
+#include "adaptive_sampler.h"
+#include "power_manager.h"
+#include "live_socket.h"
+#include "web_assets.h"
+#include "json_writer.h"
+#include "history_manager.h"
+
+
+// Requests are served from the async TCP task, so many clients are handled
+// concurrently and a slow one never stalls the main loop
+AsyncWebServer server(WEB_SERVER_PORT);
+
+// Server-Sent Events stream of the tank record
+#define EVENT_KEEPALIVE_INTERVAL 15000  // Comment line so proxies and browsers keep the stream
+#define JSON_BUFFER_SIZE 1024          // Largest JSON response (tank data is ~600 bytes)
+#define RESTART_DELAY 1000              // Lets the response reach the browser before a restart
+static AsyncEventSource events("/events");
+
+// Tank data snapshot, serialized once per new measurement and served to every poll
+static char tankSnapshot[JSON_BUFFER_SIZE] = "";
+static size_t tankSnapshotLength = 0;
+static uint32_t tankSnapshotVersion = 0;
+static uint32_t tankSnapshotEpoch = 0;      // Random per boot so ETags never repeat across restarts
+static char tankSnapshotETag[24] = "";
+static volatile bool tankSnapshotStale = true;
+static SemaphoreHandle_t tankSnapshotMutex = NULL;
+
+// /tank-data cache statistics, reported by /metrics
+static uint32_t tankDataHits = 0;         // Served from the snapshot
+static uint32_t tankDataMisses = 0;       // Snapshot had to be rebuilt first
+static uint32_t tankDataNotModified = 0;  // Answered 304
+static unsigned long lastEventKeepAlive = 0;
+
+// Restart requested by a handler, carried out from the main loop
+static unsigned long restartRequestedAt = 0;
+static bool restartPending = false;
+static bool wifiResetPending = false;
+
+// Settings stored by a handler, applied to the sensor and tank state from the
+// main loop so the filters are never resized under a running measurement
+static volatile bool settingsApplyPending = false;
 
+// Forward declarations of handler functions
+void handleRoot(AsyncWebServerRequest* request);
+void handleSet(AsyncWebServerRequest* request);
+void handleTankData(AsyncWebServerRequest* request);
+void handleSettings(AsyncWebServerRequest* request);
+void handleCalibrate(AsyncWebServerRequest* request);
+void handleNetworkSettings(AsyncWebServerRequest* request);
+void handleResetWifi(AsyncWebServerRequest* request);
+void handleScanNetworks(AsyncWebServerRequest* request);
+void handleSettingsPage(AsyncWebServerRequest* request);
+void handleMetrics(AsyncWebServerRequest* request);
+void handleHistory(AsyncWebServerRequest* request);
+
+// Serve a prebuilt gzip asset, or 304 when the browser already has this version
+static void sendAsset(AsyncWebServerRequest* request, const WebAsset& asset) {
+  if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == asset.etag) {
+    AsyncWebServerResponse* response = request->beginResponse(304);
+    response->addHeader("ETag", asset.etag);
+    response->addHeader("Cache-Control", asset.cacheControl);
+    request->send(response);
+    return;
+  }
+  
+  AsyncWebServerResponse* response = request->beginResponse_P(200, asset.contentType, asset.data, asset.length);
+  response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("ETag", asset.etag);
+  response->addHeader("Cache-Control", asset.cacheControl);
+  request->send(response);
+}
 
-WebServer server(WEB_SERVER_PORT);
+void sendAsset(AsyncWebServerRequest* request, const char* path) {
+  for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    if (strcmp(WEB_ASSETS[i].path, path) == 0) {
+      sendAsset(request, WEB_ASSETS[i]);
+      return;
+    }
+  }
+  request->send(404, "text/plain", "Not found");
+}
 
-// Forward declarations of handler functions
-void handleRoot();
-void handleSet();
-void handleTankData();
-void handleSettings();
-void handleCalibrate();
-void handleNetworkSettings();
-void handleResetWifi();
-void handleScanNetworks();
-void handleSettingsPage();
+// Stream a page template from flash as a chunked response, substituting
+// {{FIELD}} placeholders as they are reached; memory use is a small fixed
+// state block per request however large the page is
+struct TemplateStream {
+  const uint8_t* data;
+  size_t length;
+  size_t offset;
+  TemplateResolver resolve;
+  char value[TEMPLATE_VALUE_SIZE];
+  size_t valueLength;
+  size_t valueOffset;
+};
+
+static size_t fillTemplate(TemplateStream& stream, uint8_t* buffer, size_t maxLen) {
+  size_t written = 0;
+  
+  while (written < maxLen) {
+    // Finish a substituted value first
+    if (stream.valueOffset < stream.valueLength) {
+      size_t n = min(maxLen - written, stream.valueLength - stream.valueOffset);
+      memcpy(buffer + written, stream.value + stream.valueOffset, n);
+      stream.valueOffset += n;
+      written += n;
+      continue;
+    }
+    
+    if (stream.offset >= stream.length) {
+      break;
+    }
+    
+    // Placeholder: resolve its name into the value buffer
+    if (pgm_read_byte(stream.data + stream.offset) == '{' && stream.offset + 1 < stream.length &&
+        pgm_read_byte(stream.data + stream.offset + 1) == '{') {
+      char name[TEMPLATE_FIELD_SIZE];
+      size_t nameLength = 0;
+      size_t end = stream.offset + 2;
+      while (end + 1 < stream.length && nameLength < sizeof(name) - 1 &&
+             (isalnum(pgm_read_byte(stream.data + end)) || pgm_read_byte(stream.data + end) == '_')) {
+        name[nameLength++] = pgm_read_byte(stream.data + end++);
+      }
+      
+      if (end + 1 < stream.length && pgm_read_byte(stream.data + end) == '}' &&
+          pgm_read_byte(stream.data + end + 1) == '}') {
+        name[nameLength] = '\0';
+        stream.valueLength = stream.resolve(name, stream.value, sizeof(stream.value));
+        stream.valueOffset = 0;
+        stream.offset = end + 2;
+        continue;
+      }
+    }
+    
+    // Static text up to the next possible placeholder
+    size_t n = 1;
+    while (stream.offset + n < stream.length && written + n < maxLen &&
+           pgm_read_byte(stream.data + stream.offset + n) != '{') {
+      n++;
+    }
+    memcpy_P(buffer + written, stream.data + stream.offset, n);
+    stream.offset += n;
+    written += n;
+  }
+  
+  return written;
+}
+
+void sendTemplate(AsyncWebServerRequest* request, const uint8_t* data, size_t length, TemplateResolver resolve) {
+  std::shared_ptr<TemplateStream> stream = std::make_shared<TemplateStream>();
+  stream->data = data;
+  stream->length = length;
+  stream->offset = 0;
+  stream->resolve = resolve;
+  stream->valueLength = 0;
+  stream->valueOffset = 0;
+  
+  AsyncWebServerResponse* response = request->beginChunkedResponse("text/html",
+    [stream](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+      return fillTemplate(*stream, buffer, maxLen);
+    });
+  response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+  request->send(response);
+}
+
+// History range being streamed; rows are formatted one at a time so memory
+// stays fixed however long the range is
+#define HISTORY_READ_BATCH 16
+#define HISTORY_ROW_SIZE 80
+#define HISTORY_DEFAULT_RANGE 3600  // Seconds returned when from is not given
+
+struct HistoryStream {
+  uint8_t tier;
+  uint32_t from;      // Next point to read
+  uint32_t to;
+  bool first;
+  bool done;
+  HistoryPoint points[HISTORY_READ_BATCH];
+  size_t pointCount;
+  size_t pointIndex;
+  char row[HISTORY_ROW_SIZE];
+  size_t rowLength;
+  size_t rowOffset;
+};
+
+// Format the next row (header, point or footer) into stream.row
+static bool nextHistoryRow(HistoryStream& stream) {
+  if (stream.done) {
+    return false;
+  }
+  
+  if (stream.pointIndex >= stream.pointCount) {
+    stream.pointCount = readHistory(stream.tier, stream.from, stream.to, stream.points, HISTORY_READ_BATCH);
+    stream.pointIndex = 0;
+    if (stream.pointCount == 0) {
+      strcpy(stream.row, "]}");
+      stream.rowLength = 2;
+      stream.done = true;
+      return true;
+    }
+  }
+  
+  const HistoryPoint& point = stream.points[stream.pointIndex++];
+  stream.from = point.time + 1;
+  
+  JsonWriter json(stream.row + 1, sizeof(stream.row) - 1);
+  json.beginArray();
+  json.add(NULL, (unsigned long)point.time);
+  if (stream.tier == HISTORY_TIER_RAW) {
+    json.add(NULL, point.avg, 2);
+  } else {
+    json.add(NULL, point.min, 2);
+    json.add(NULL, point.avg, 2);
+    json.add(NULL, point.max, 2);
+  }
+  json.endArray();
+  
+  // Leading comma between rows
+  if (stream.first) {
+    memmove(stream.row, stream.row + 1, json.length() + 1);
+    stream.rowLength = json.length();
+    stream.first = false;
+  } else {
+    stream.row[0] = ',';
+    stream.rowLength = json.length() + 1;
+  }
+  return true;
+}
+
+static size_t fillHistory(HistoryStream& stream, uint8_t* buffer, size_t maxLen) {
+  size_t written = 0;
+  
+  while (written < maxLen) {
+    if (stream.rowOffset >= stream.rowLength) {
+      if (!nextHistoryRow(stream)) {
+        break;
+      }
+      stream.rowOffset = 0;
+    }
+    
+    size_t n = min(maxLen - written, stream.rowLength - stream.rowOffset);
+    memcpy(buffer + written, stream.row + stream.rowOffset, n);
+    stream.rowOffset += n;
+    written += n;
+  }
+  
+  return written;
+}
+
+// Handle history API: /history?from=&to=&res= (res: raw, 300, 3600; default picks by range)
+void handleHistory(AsyncWebServerRequest* request) {
+  // After a wake from deep sleep the flash log is only read once it is needed
+  if (!requestHistoryLog()) {
+    AsyncWebServerResponse* response = request->beginResponse(503, "text/plain", "History is loading, retry shortly");
+    response->addHeader("Retry-After", "1");
+    request->send(response);
+    return;
+  }
+  
+  uint32_t now = getHistoryTime();
+  uint32_t to = request->hasArg("to") ? (uint32_t)request->arg("to").toInt() : now;
+  uint32_t from = request->hasArg("from") ? (uint32_t)request->arg("from").toInt()
+                                          : (to > HISTORY_DEFAULT_RANGE ? to - HISTORY_DEFAULT_RANGE : 0);
+  
+  uint8_t tier;
+  String res = request->hasArg("res") ? request->arg("res") : String("");
+  if (res == "raw" || res == "0") {
+    tier = HISTORY_TIER_RAW;
+  } else if (res.toInt() == HISTORY_MINUTE_BUCKET) {
+    tier = HISTORY_TIER_MINUTE;
+  } else if (res.toInt() == HISTORY_HOUR_BUCKET) {
+    tier = HISTORY_TIER_HOUR;
+  } else if (res.length() == 0) {
+    tier = selectHistoryTier(from);
+  } else {
+    request->send(400, "text/plain", "res must be raw, 300 or 3600");
+    return;
+  }
+  
+  std::shared_ptr<HistoryStream> stream = std::make_shared<HistoryStream>();
+  stream->tier = tier;
+  stream->from = from;
+  stream->to = to;
+  stream->first = true;
+  stream->done = false;
+  stream->pointCount = 0;
+  stream->pointIndex = 0;
+  stream->rowOffset = 0;
+  
+  // Header goes out as the first row
+  JsonWriter json(stream->row, sizeof(stream->row));
+  json.beginObject();
+  json.add("now", (unsigned long)now);
+  json.add("clockValid", isHistoryClockValid());
+  json.add("res", (unsigned long)HistoryStore::resolution(tier));
+  stream->rowLength = json.length();
+  strncpy(stream->row + stream->rowLength, ",\"points\":[", sizeof(stream->row) - stream->rowLength - 1);
+  stream->rowLength = strlen(stream->row);
+  
+  AsyncWebServerResponse* response = request->beginChunkedResponse("application/json",
+    [stream](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+      return fillHistory(*stream, buffer, maxLen);
+    });
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+
+// Live fields of the network settings page
+static size_t networkTemplateField(const char* name, char* value, size_t size) {
+  if (strcmp(name, "MODE") == 0) {
+    const char* modeText;
+    if (wifiManager.getMode() == WIFI_MANAGER_MODE_AP) {
+      modeText = "Access Point";
+    } else if (wifiManager.getMode() == WIFI_MANAGER_MODE_STA) {
+      modeText = "Connected to WiFi";
+    } else {
+      modeText = "Fallback AP Mode";
+    }
+    strncpy(value, modeText, size - 1);
+  } else if (strcmp(name, "IP_ADDRESS") == 0) {
+    // Get the IP address from the WiFi manager
+    strncpy(value, wifiManager.getIPAddress().c_str(), size - 1);
+  } else {
+    value[0] = '\0';
+  }
+  value[size - 1] = '\0';
+  return strlen(value);
+}
 
 void setupWebServer() {
+  tankSnapshotMutex = xSemaphoreCreateMutex();
+  tankSnapshotEpoch = esp_random();
+  
   server.on("/", handleRoot);
   server.on("/set", handleSet);
   server.on("/tank-data", handleTankData);
@@ -31,6 +350,34 @@ void setupWebServer() {
   server.on("/resetwifi", handleResetWifi);
   server.on("/scannetworks", handleScanNetworks);
   server.on("/settings.html", handleSettingsPage);
+  server.on("/metrics", handleMetrics);
+  server.on("/history", handleHistory);
+  
+  // Stylesheets and scripts split out of the pages by tools/build_web_assets.py
+  for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    const WebAsset& asset = WEB_ASSETS[i];
+    if (strncmp(asset.path, "/assets/", 8) == 0) {
+      server.on(asset.path, [&asset](AsyncWebServerRequest* request) {
+        sendAsset(request, asset);
+      });
+    }
+  }
+  
+  // Send the current record on subscribe so the page does not wait for the next change
+  events.onConnect([](AsyncEventSourceClient* client) {
+    Serial.println("[Events] Client subscribed");
+    char json[JSON_BUFFER_SIZE];
+    xSemaphoreTake(tankSnapshotMutex, portMAX_DELAY);
+    strcpy(json, tankSnapshot);
+    xSemaphoreGive(tankSnapshotMutex);
+    if (json[0] != '\0') {
+      client->send(json, "tank", millis(), 5000);
+    }
+  });
+  server.addHandler(&events);
+  
+  // Live data WebSocket on /ws
+  setupLiveSocket(server);
   
 
   
@@ -40,227 +387,485 @@ void setupWebServer() {
 }
 
 void handleWebServer() {
-  server.handleClient();
+  // Requests are handled by the async server; only deferred work runs here
+  
+  // Keep idle event streams open through proxies
+  if (millis() - lastEventKeepAlive >= EVENT_KEEPALIVE_INTERVAL) {
+    lastEventKeepAlive = millis();
+    events.send(":keep-alive", NULL, 0, 0);
+  }
+  
+  // Apply settings changed by /set, /calibrate or a socket command
+  if (settingsApplyPending) {
+    settingsApplyPending = false;
+    updateSmoothingBuffer();
+    updateShotFilter();
+    saveSettings();
+    
+    // Recalculate water level with new settings
+    calculateWaterLevel();
+    invalidateTankSnapshot();
+    publishTankData();
+    publishLiveData();
+  }
+  
+  if (restartPending && millis() - restartRequestedAt >= RESTART_DELAY) {
+    saveHistory(true);
+    flushSettings();
+    
+    if (wifiResetPending) {
+      // resetWifiSettings() will restart the device
+      wifiManager.resetWifiSettings();
+    } else {
+      ESP.restart();
+    }
+  }
+}
+
+// Restart (optionally clearing WiFi settings) once the response has been sent
+static void scheduleRestart(bool resetWifi) {
+  wifiResetPending = resetWifi;
+  restartRequestedAt = millis();
+  restartPending = true;
+}
+
+void scheduleSettingsApply() {
+  settingsApplyPending = true;
+}
+
+// Build the real-time tank record shared by /tank-data and /events
+size_t buildTankDataJson(char* buffer, size_t size) {
+  JsonWriter json(buffer, size);
+  json.beginObject();
+  json.add("distance", currentDistance, 1);
+  json.add("trackedDistance", trackedDistance, 1);
+  json.add("fillRate", currentFillRate, 2);
+  json.add("airTemperature", currentAirTemperature, 1);
+  json.add("levelRate", currentLevelRate, 2);
+  json.add("sampleInterval", getSampleInterval());
+  json.add("lowPowerMode", lowPowerMode);
+  json.add("awakeTime", getLastAwakeTime());
+  json.add("wakeCount", getWakeCount());
+  json.add("waterLevel", currentWaterLevel, 1);
+  json.add("percentage", currentPercentage, 1);
+  json.add("volume", currentVolume, 1);
+  json.add("tankHeight", tankHeight, 1);
+  json.add("tankDiameter", tankDiameter, 1);
+  json.add("tankVolume", tankVolume, 1);
+  json.add("alertLevelLow", alertLevelLow);
+  json.add("alertLevelHigh", alertLevelHigh);
+  json.add("lowAlertActive", lowAlertActive);
+  json.add("highAlertActive", highAlertActive);
+  json.add("alertsEnabled", alertsEnabled);
+  json.endObject();
+  return json.overflowed() ? 0 : json.length();
+}
+
+// Rebuild the snapshot; returns true (with the record in json) if it changed
+static bool refreshTankSnapshot(char* json, size_t size) {
+  size_t length = buildTankDataJson(json, size);
+  if (length == 0) {
+    return false;
+  }
+  
+  bool changed = false;
+  xSemaphoreTake(tankSnapshotMutex, portMAX_DELAY);
+  if (length != tankSnapshotLength || memcmp(json, tankSnapshot, length) != 0) {
+    memcpy(tankSnapshot, json, length + 1);
+    tankSnapshotLength = length;
+    tankSnapshotVersion++;
+    snprintf(tankSnapshotETag, sizeof(tankSnapshotETag), "\"%08x-%u\"",
+             (unsigned int)tankSnapshotEpoch, (unsigned int)tankSnapshotVersion);
+    changed = true;
+  }
+  tankSnapshotStale = false;
+  xSemaphoreGive(tankSnapshotMutex);
+  return changed;
+}
+
+void publishTankData() {
+  char json[JSON_BUFFER_SIZE];
+  
+  // Only push when the record actually changed
+  if (refreshTankSnapshot(json, sizeof(json))) {
+    events.send(json, "tank", millis());
+  }
+}
+
+void invalidateTankSnapshot() {
+  tankSnapshotStale = true;
+}
+
+// Send a JSON body built in a fixed buffer (no-store headers for live data)
+static void sendJson(AsyncWebServerRequest* request, const char* json, size_t length, bool noCache) {
+  if (length == 0) {
+    request->send(500, "text/plain", "Response too large");
+    return;
+  }
+  
+  AsyncWebServerResponse* response = request->beginResponse(200, "application/json", json);
+  if (noCache) {
+    response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+    response->addHeader("Pragma", "no-cache");
+    response->addHeader("Expires", "-1");
+  }
+  request->send(response);
 }
 
 // Handle scan networks API
-void handleScanNetworks() {
-  std::vector<WiFiNetwork> networks = wifiManager.scanNetworks();
+void handleScanNetworks(AsyncWebServerRequest* request) {
+  // Answer from the cache right away, refreshing in the background when stale
+  // (the scan itself is started from the main loop)
+  if (wifiManager.isScanStale() || request->hasArg("refresh")) {
+    wifiManager.scheduleScan();
+  }
+  std::vector<WiFiNetwork> networks = wifiManager.getScanResults();
   
-  String json = "[";
+  char buffer[JSON_BUFFER_SIZE];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.add("scanAge", wifiManager.getScanAge());
+  json.add("scanning", wifiManager.isScanning());
+  json.beginArray("networks");
   
-  if (!networks.empty()) {
-    // Limit to top 5 networks with strongest signal
-    int count = min(5, (int)networks.size());
-    
-    for (int i = 0; i < count; i++) {
-      if (i > 0) json += ",";
-      
-      // Encode the SSID for JSON (escaping quotes and backslashes)
-      String escapedSSID = networks[i].ssid;
-      escapedSSID.replace("\\", "\\\\");  // Escape backslashes first
-      escapedSSID.replace("\"", "\\\"");  // Then escape quotes
-      
-      json += "{\"ssid\":\"" + escapedSSID + "\",";
-      json += "\"rssi\":" + String(networks[i].rssi) + ",";
-      json += "\"secure\":" + String(networks[i].encType != WIFI_AUTH_OPEN ? "true" : "false") + "}";
-    }
+  // Limit to top 5 networks with strongest signal
+  int count = min(5, (int)networks.size());
+  for (int i = 0; i < count; i++) {
+    json.beginObject();
+    json.add("ssid", networks[i].ssid.c_str());
+    json.add("rssi", (long)networks[i].rssi);
+    json.add("secure", networks[i].encType != WIFI_AUTH_OPEN);
+    json.endObject();
   }
   
-  json += "]";
+  json.endArray();
+  json.endObject();
   
   // Send response with appropriate headers
-  server.sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-  server.sendHeader("Pragma", "no-cache");
-  server.sendHeader("Expires", "-1");
-  server.send(200, "application/json", json);
+  sendJson(request, buffer, json.overflowed() ? 0 : json.length(), true);
 }
 
 // Handle tank data API (returns real-time tank data)
-void handleTankData() {
-  String json = "{";
-  json += "\"distance\":" + String(currentDistance, 1) + ",";
-  json += "\"waterLevel\":" + String(currentWaterLevel, 1) + ",";
-  json += "\"percentage\":" + String(currentPercentage, 1) + ",";
-  json += "\"volume\":" + String(currentVolume, 1) + ",";
-  json += "\"tankHeight\":" + String(tankHeight, 1) + ",";
-  json += "\"tankDiameter\":" + String(tankDiameter, 1) + ",";
-  json += "\"tankVolume\":" + String(tankVolume, 1) + ",";
-  json += "\"alertLevelLow\":" + String(alertLevelLow) + ",";
-  json += "\"alertLevelHigh\":" + String(alertLevelHigh) + ",";
-  json += "\"alertsEnabled\":" + String(alertsEnabled ? "true" : "false");
-  json += "}";
+void handleTankData(AsyncWebServerRequest* request) {
+  // Settings changed since the last measurement, rebuild before serving
+  if (tankSnapshotStale) {
+    tankDataMisses++;
+    char json[JSON_BUFFER_SIZE];
+    if (refreshTankSnapshot(json, sizeof(json))) {
+      events.send(json, "tank", millis());
+    }
+  } else {
+    tankDataHits++;
+  }
+  
+  xSemaphoreTake(tankSnapshotMutex, portMAX_DELAY);
+  
+  AsyncWebServerResponse* response;
+  if (tankSnapshotLength == 0) {
+    response = request->beginResponse(503, "text/plain", "No data yet");
+  } else if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == tankSnapshotETag) {
+    tankDataNotModified++;
+    response = request->beginResponse(304);
+    response->addHeader("ETag", tankSnapshotETag);
+  } else {
+    response = request->beginResponse(200, "application/json", tankSnapshot);
+    response->addHeader("ETag", tankSnapshotETag);
+  }
+  
+  xSemaphoreGive(tankSnapshotMutex);
+  
+  // Browsers revalidate every poll and get 304 while the data is unchanged
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+
+// Handle metrics API (cache statistics and system health)
+void handleMetrics(AsyncWebServerRequest* request) {
+  char buffer[JSON_BUFFER_SIZE];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.add("uptime", millis() / 1000);
+  json.add("freeHeap", (unsigned long)ESP.getFreeHeap());
+  json.add("tankDataVersion", (unsigned long)tankSnapshotVersion);
+  json.add("tankDataHits", (unsigned long)tankDataHits);
+  json.add("tankDataMisses", (unsigned long)tankDataMisses);
+  json.add("tankDataNotModified", (unsigned long)tankDataNotModified);
+  json.add("settingsCommits", (unsigned long)getSettingsCommitCount());
+  json.add("settingsCommitsSkipped", (unsigned long)getSettingsSkippedCommitCount());
+  json.add("settingsPending", settingsPending());
+  json.endObject();
   
-  server.sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-  server.sendHeader("Pragma", "no-cache");
-  server.sendHeader("Expires", "-1");
-  server.send(200, "application/json", json);
+  sendJson(request, buffer, json.overflowed() ? 0 : json.length(), true);
 }
 
 // Handle Settings API (returns current settings as JSON)
-void handleSettings() {
-  String json = "{";
-  json += "\"tankHeight\":" + String(tankHeight, 1) + ",";
-  json += "\"tankDiameter\":" + String(tankDiameter, 1) + ",";
-  json += "\"tankVolume\":" + String(tankVolume, 1) + ",";
-  json += "\"sensorOffset\":" + String(sensorOffset, 1) + ",";
-  json += "\"emptyDistance\":" + String(emptyDistance, 1) + ",";
-  json += "\"fullDistance\":" + String(fullDistance, 1) + ",";
-  json += "\"measurementInterval\":" + String(measurementInterval) + ",";
-  json += "\"readingSmoothing\":" + String(readingSmoothing) + ",";
-  json += "\"alertLevelLow\":" + String(alertLevelLow) + ",";
-  json += "\"alertLevelHigh\":" + String(alertLevelHigh) + ",";
-  json += "\"alertsEnabled\":" + String(alertsEnabled ? "true" : "false");
-  json += "}";
+void handleSettings(AsyncWebServerRequest* request) {
+  char buffer[JSON_BUFFER_SIZE];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.add("tankHeight", tankHeight, 1);
+  json.add("tankDiameter", tankDiameter, 1);
+  json.add("tankVolume", tankVolume, 1);
+  json.add("sensorOffset", sensorOffset, 1);
+  json.add("emptyDistance", emptyDistance, 1);
+  json.add("fullDistance", fullDistance, 1);
+  json.add("measurementInterval", measurementInterval);
+  json.add("readingSmoothing", readingSmoothing);
+  json.add("filterWindow", filterWindow);
+  json.add("hampelThreshold", hampelThreshold, 1);
+  json.add("levelTracker", levelTrackerEnabled);
+  json.add("airTemperature", airTemperature);
+  json.add("adaptiveSampling", adaptiveSampling);
+  json.add("fastMeasurementInterval", fastMeasurementInterval);
+  json.add("lowPowerMode", lowPowerMode);
+  json.add("alertLevelLow", alertLevelLow);
+  json.add("alertLevelHigh", alertLevelHigh);
+  json.add("alertsEnabled", alertsEnabled);
+  json.endObject();
   
-  server.send(200, "application/json", json);
+  sendJson(request, buffer, json.overflowed() ? 0 : json.length(), false);
 }
 
 // Handle Calibration
-void handleCalibrate() {
-  if (server.hasArg("type")) {
-    String calibrationType = server.arg("type");
+void handleCalibrate(AsyncWebServerRequest* request) {
+  if (request->hasArg("type")) {
+    String calibrationType = request->arg("type");
     
-    if (calibrationType == "empty") {
-      // Store current distance as empty reading
-      emptyDistance = currentDistance;
-      saveSettings();
-      server.send(200, "text/plain", "Empty calibration saved: " + String(emptyDistance, 1) + " cm");
+    if (!applyCalibration(calibrationType)) {
+      request->send(400, "text/plain", "Invalid calibration type");
     } 
-    else if (calibrationType == "full") {
-      // Store current distance as full reading
-      fullDistance = currentDistance;
-      saveSettings();
-      server.send(200, "text/plain", "Full calibration saved: " + String(fullDistance, 1) + " cm");
+    else if (calibrationType == "empty") {
+      request->send(200, "text/plain", "Empty calibration saved: " + String(emptyDistance, 1) + " cm");
     }
     else {
-      server.send(400, "text/plain", "Invalid calibration type");
+      request->send(200, "text/plain", "Full calibration saved: " + String(fullDistance, 1) + " cm");
     }
   } else {
-    server.send(400, "text/plain", "Missing calibration type");
+    request->send(400, "text/plain", "Missing calibration type");
   }
 }
 
-// Handle Settings Update
-void handleSet() {
-  bool settingsChanged = false;
+// /set parameters in the order they are applied (empty before full distance)
+const char* const SETTING_NAMES[] = {
+  "tankHeight",
+  "tankDiameter",
+  "tankVolume",
+  "sensorOffset",
+  "emptyDistance",
+  "fullDistance",
+  "measurementInterval",
+  "readingSmoothing",
+  "filterWindow",
+  "hampelThreshold",
+  "airTemperature",
+  "adaptiveSampling",
+  "fastMeasurementInterval",
+  "lowPowerMode",
+  "levelTracker",
+  "alertLevelLow",
+  "alertLevelHigh",
+  "alertsEnabled"
+};
+const size_t SETTING_COUNT = sizeof(SETTING_NAMES) / sizeof(SETTING_NAMES[0]);
+
+// Apply one setting with its range check
+bool applySetting(const String& name, const String& value) {
+  bool accepted = false;
   
   // Tank Height
-  if (server.hasArg("tankHeight")) {
-    float newTankHeight = server.arg("tankHeight").toFloat();
+  if (name == "tankHeight") {
+    float newTankHeight = value.toFloat();
     if (newTankHeight > 0 && newTankHeight <= 1000) {
       tankHeight = newTankHeight;
-      settingsChanged = true;
+      accepted = true;
     }
   }
   
   // Tank Diameter
-  if (server.hasArg("tankDiameter")) {
-    float newTankDiameter = server.arg("tankDiameter").toFloat();
+  if (name == "tankDiameter") {
+    float newTankDiameter = value.toFloat();
     if (newTankDiameter > 0 && newTankDiameter <= 1000) {
       tankDiameter = newTankDiameter;
-      settingsChanged = true;
+      accepted = true;
     }
   }
   
   // Tank Volume
-  if (server.hasArg("tankVolume")) {
-    float newTankVolume = server.arg("tankVolume").toFloat();
+  if (name == "tankVolume") {
+    float newTankVolume = value.toFloat();
     if (newTankVolume > 0 && newTankVolume <= 100000) {
       tankVolume = newTankVolume;
-      settingsChanged = true;
+      accepted = true;
     }
   }
   
   // Sensor Offset
-  if (server.hasArg("sensorOffset")) {
-    float newSensorOffset = server.arg("sensorOffset").toFloat();
+  if (name == "sensorOffset") {
+    float newSensorOffset = value.toFloat();
     if (newSensorOffset >= 0 && newSensorOffset <= 100) {
       sensorOffset = newSensorOffset;
-      settingsChanged = true;
+      accepted = true;
     }
   }
   
   // Empty Distance
-  if (server.hasArg("emptyDistance")) {
-    float newEmptyDistance = server.arg("emptyDistance").toFloat();
+  if (name == "emptyDistance") {
+    float newEmptyDistance = value.toFloat();
     if (newEmptyDistance > 0 && newEmptyDistance <= 500) {
       emptyDistance = newEmptyDistance;
-      settingsChanged = true;
+      accepted = true;
     }
   }
   
   // Full Distance
-  if (server.hasArg("fullDistance")) {
-    float newFullDistance = server.arg("fullDistance").toFloat();
+  if (name == "fullDistance") {
+    float newFullDistance = value.toFloat();
     if (newFullDistance >= 0 && newFullDistance < emptyDistance) {
       fullDistance = newFullDistance;
-      settingsChanged = true;
+      accepted = true;
     }
   }
   
   // Measurement Interval
-  if (server.hasArg("measurementInterval")) {
-    int newMeasurementInterval = server.arg("measurementInterval").toInt();
+  if (name == "measurementInterval") {
+    int newMeasurementInterval = value.toInt();
     if (newMeasurementInterval >= 1 && newMeasurementInterval <= 3600) {
       measurementInterval = newMeasurementInterval;
-      settingsChanged = true;
+      accepted = true;
     }
   }
   
   // Reading Smoothing
-  if (server.hasArg("readingSmoothing")) {
-    int newReadingSmoothing = server.arg("readingSmoothing").toInt();
-    if (newReadingSmoothing >= 1 && newReadingSmoothing <= 50) {
+  if (name == "readingSmoothing") {
+    int newReadingSmoothing = value.toInt();
+    if (newReadingSmoothing >= 1 && newReadingSmoothing <= MAX_READING_SMOOTHING) {
       readingSmoothing = newReadingSmoothing;
-      settingsChanged = true;
+      accepted = true;
     }
   }
-  if (settingsChanged && server.hasArg("readingSmoothing")) {
-    updateSmoothingBuffer();
+  
+  // Filter Window
+  if (name == "filterWindow") {
+    int newFilterWindow = value.toInt();
+    if (newFilterWindow >= 1 && newFilterWindow <= MAX_FILTER_WINDOW) {
+      filterWindow = newFilterWindow;
+      accepted = true;
+    }
+  }
+  
+  // Hampel Threshold
+  if (name == "hampelThreshold") {
+    float newHampelThreshold = value.toFloat();
+    if (newHampelThreshold >= 0 && newHampelThreshold <= 10) {
+      hampelThreshold = newHampelThreshold;
+      accepted = true;
+    }
+  }
+  
+  // Air Temperature (used when no temperature sensor is fitted)
+  if (name == "airTemperature") {
+    int newAirTemperature = value.toInt();
+    if (newAirTemperature >= -40 && newAirTemperature <= 85) {
+      airTemperature = newAirTemperature;
+      accepted = true;
+    }
+  }
+  
+  // Adaptive Sampling
+  if (name == "adaptiveSampling") {
+    String adaptiveSamplingStr = value;
+    adaptiveSampling = (adaptiveSamplingStr == "true" || adaptiveSamplingStr == "1");
+    accepted = true;
+  }
+  
+  // Fast Measurement Interval
+  if (name == "fastMeasurementInterval") {
+    int newFastMeasurementInterval = value.toInt();
+    if (newFastMeasurementInterval >= MIN_FAST_MEASUREMENT_INTERVAL && newFastMeasurementInterval <= 60000) {
+      fastMeasurementInterval = newFastMeasurementInterval;
+      accepted = true;
+    }
+  }
+  
+  // Low-Power Mode
+  if (name == "lowPowerMode") {
+    String lowPowerModeStr = value;
+    lowPowerMode = (lowPowerModeStr == "true" || lowPowerModeStr == "1");
+    accepted = true;
   }
+  
+  // Level Tracker
+  if (name == "levelTracker") {
+    String levelTrackerStr = value;
+    levelTrackerEnabled = (levelTrackerStr == "true" || levelTrackerStr == "1");
+    accepted = true;
+  }
+  
   // Alert Level Low
-  if (server.hasArg("alertLevelLow")) {
-    int newAlertLevelLow = server.arg("alertLevelLow").toInt();
+  if (name == "alertLevelLow") {
+    int newAlertLevelLow = value.toInt();
     if (newAlertLevelLow >= 0 && newAlertLevelLow <= 100) {
       alertLevelLow = newAlertLevelLow;
-      settingsChanged = true;
+      accepted = true;
     }
   }
   
   // Alert Level High
-  if (server.hasArg("alertLevelHigh")) {
-    int newAlertLevelHigh = server.arg("alertLevelHigh").toInt();
+  if (name == "alertLevelHigh") {
+    int newAlertLevelHigh = value.toInt();
     if (newAlertLevelHigh >= 0 && newAlertLevelHigh <= 100) {
       alertLevelHigh = newAlertLevelHigh;
-      settingsChanged = true;
+      accepted = true;
     }
   }
   
   // Alerts Enabled
-  if (server.hasArg("alertsEnabled")) {
-    String alertsEnabledStr = server.arg("alertsEnabled");
+  if (name == "alertsEnabled") {
+    String alertsEnabledStr = value;
     alertsEnabled = (alertsEnabledStr == "true" || alertsEnabledStr == "1");
-    settingsChanged = true;
+    accepted = true;
+  }
+  
+  return accepted;
+}
+
+// Store current distance as the empty or full calibration point
+bool applyCalibration(const String& type) {
+  if (type == "empty") {
+    emptyDistance = currentDistance;
+  } else if (type == "full") {
+    fullDistance = currentDistance;
+  } else {
+    return false;
+  }
+  scheduleSettingsApply();
+  return true;
+}
+
+// Handle Settings Update
+void handleSet(AsyncWebServerRequest* request) {
+  bool settingsChanged = false;
+  
+  for (size_t i = 0; i < SETTING_COUNT; i++) {
+    if (request->hasArg(SETTING_NAMES[i]) && applySetting(SETTING_NAMES[i], request->arg(SETTING_NAMES[i]))) {
+      settingsChanged = true;
+    }
   }
   
-  // Save settings if any changed
+  // Save and apply from the main loop if any changed
   if (settingsChanged) {
-    saveSettings();
-    
-    // Recalculate water level with new settings
-    calculateWaterLevel();
+    scheduleSettingsApply();
     
-    server.send(200, "text/html", "<h3>Settings Updated! <a href='/'>Back</a></h3>");
+    request->send(200, "text/html", "<h3>Settings Updated! <a href='/'>Back</a></h3>");
   } else {
-    server.send(200, "text/html", "<h3>No settings were changed. <a href='/'>Back</a></h3>");
+    request->send(200, "text/html", "<h3>No settings were changed. <a href='/'>Back</a></h3>");
   }
 }
 
 
 
 // Handle Wifi Reset
-void handleResetWifi() {
+void handleResetWifi(AsyncWebServerRequest* request) {
   String html = R"rawliteral(
     <!DOCTYPE html>
     <html>
@@ -303,31 +908,42 @@ void handleResetWifi() {
     </html>
   )rawliteral";
   
-  server.send(200, "text/html", html);
+  request->send(200, "text/html", html);
   
-  // Reset WiFi settings
-  delay(1000);
-  wifiManager.resetWifiSettings();
-  // resetWifiSettings() will restart the device
+  // Reset WiFi settings and restart after the page is sent
+  scheduleRestart(true);
 }
 
 
-void handleNetworkSettings() {
-  if (server.hasArg("ssid") && server.hasArg("password") && server.hasArg("deviceName")) {
+void handleNetworkSettings(AsyncWebServerRequest* request) {
+  if (request->hasArg("ssid") && request->hasArg("password") && request->hasArg("deviceName")) {
     // Get form data
-    String ssid = server.arg("ssid");
-    String password = server.arg("password");
-    String deviceName = server.arg("deviceName");
+    String ssid = request->arg("ssid");
+    String password = request->arg("password");
+    String deviceName = request->arg("deviceName");
     
     // Validate inputs
     if (ssid.length() == 0 || deviceName.length() == 0) {
-      server.send(400, "text/html", "<h1>Error</h1><p>SSID and Device Name cannot be empty</p><a href='/network'>Back</a>");
+      request->send(400, "text/html", "<h1>Error</h1><p>SSID and Device Name cannot be empty</p><a href='/network'>Back</a>");
       return;
     }
     
     // Save credentials to EEPROM
     wifiManager.saveWifiCredentials(ssid.c_str(), password.c_str(), deviceName.c_str());
     
+    // Optional static IP (an empty or invalid address selects DHCP)
+    StaticIPConfig staticIP = {0, 0, 0, 0};
+    IPAddress address;
+    if (request->hasArg("staticIP") && address.fromString(request->arg("staticIP"))) {
+      staticIP.ip = (uint32_t)address;
+      if (address.fromString(request->arg("gateway"))) staticIP.gateway = (uint32_t)address;
+      if (address.fromString(request->arg("subnet"))) staticIP.subnet = (uint32_t)address;
+      else staticIP.subnet = (uint32_t)IPAddress(255, 255, 255, 0);
+      if (address.fromString(request->arg("dns"))) staticIP.dns = (uint32_t)address;
+      else staticIP.dns = staticIP.gateway;
+    }
+    wifiManager.saveStaticIPConfig(staticIP);
+    
     // Format hostname from the device name
     String hostname = wifiManager.getSanitizedHostname(deviceName.c_str());
 
@@ -348,1683 +964,21 @@ void handleNetworkSettings() {
     html += "<p>Device restarting in <span id='timer'>10</span> seconds...</p></div>";
     html += "<div id='countdown-info' class='countdown'></div></div></body></html>";
           
-    server.send(200, "text/html", html);
+    request->send(200, "text/html", html);
     
     // Schedule restart
-    delay(1000);
-    ESP.restart();  
+    scheduleRestart(false);
   } else {
-    // Display network settings form
-    // Determine current mode text
-    String modeText;
-    if (wifiManager.getMode() == WIFI_MANAGER_MODE_AP) {
-      modeText = "Access Point";
-    } else if (wifiManager.getMode() == WIFI_MANAGER_MODE_STA) {
-      modeText = "Connected to WiFi";
-    } else {
-      modeText = "Fallback AP Mode";
-    }
-
-    // Get the IP address from the WiFi manager
-    String ipAddress = wifiManager.getIPAddress();
-
-    // Create the network settings form HTML
-    String html = R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-  <title>Network Settings - Aqualevel</title>
-  <meta name='viewport' content='width=device-width, initial-scale=1'>
-  <style>
-    :root {
-      --primary: #2196F3;
-      --primary-light: #64B5F6;
-      --primary-dark: #1976D2;
-      --secondary: #03A9F4;
-      --accent: #00BCD4;
-      --success: #4CAF50;
-      --warning: #FFC107;
-      --danger: #F44336;
-      --bg-dark: #121212;
-      --bg-card: #1e1e1e;
-      --text: #ffffff;
-      --text-secondary: #b0b0b0;
-      --border-radius: 12px;
-      --shadow: 0 10px 20px rgba(0,0,0,0.3);
-      --transition: all 0.3s ease;
-    }
-    
-    * {
-      margin: 0;
-      padding: 0;
-      box-sizing: border-box;
-    }
-    
-    body {
-      font-family: 'Segoe UI', Tahoma, Geneva, Verdana, sans-serif;
-      background-color: var(--bg-dark);
-      color: var(--text);
-      min-height: 100vh;
-      display: flex;
-      flex-direction: column;
-      padding: 20px;
-      background: linear-gradient(135deg, #121212 0%, #2a2a2a 100%);
-    }
-    
-    .container {
-      width: 100%;
-      max-width: 600px;
-      margin: 0 auto;
-      display: flex;
-      flex-direction: column;
-      gap: 20px;
-    }
-    
-    .card {
-      background: var(--bg-card);
-      border-radius: var(--border-radius);
-      box-shadow: var(--shadow);
-      overflow: hidden;
-    }
-    
-    .card-header {
-      background: linear-gradient(135deg, var(--primary) 0%, var(--primary-light) 100%);
-      padding: 20px;
-      text-align: center;
-    }
-    
-    .card-header h1 {
-      font-size: 24px;
-      font-weight: 600;
-      margin-bottom: 8px;
-      text-shadow: 0 2px 5px rgba(0,0,0,0.2);
-    }
-    
-    .card-header p {
-      opacity: 0.9;
-      font-size: 14px;
-    }
-    
-    .card-content {
-      padding: 20px;
-    }
-    
-    .status-container {
-      background: #1a1a1a;
-      border-radius: var(--border-radius);
-      padding: 15px;
-      margin-bottom: 20px;
-    }
-    
-    .status-item {
-      display: flex;
-      justify-content: space-between;
-      margin-bottom: 10px;
-      font-size: 14px;
-    }
-    
-    .status-item:last-child {
-      margin-bottom: 0;
-    }
-    
-    .status-label {
-      color: var(--text-secondary);
-    }
-    
-    .status-value {
-      font-weight: 500;
-    }
-    
-    .form-row {
-      margin-bottom: 20px;
-    }
-    
-    .form-label {
-      display: block;
-      margin-bottom: 8px;
-      font-size: 14px;
-      color: var(--text-secondary);
-    }
-    
-    .form-input {
-      width: 100%;
-      padding: 12px;
-      background: #2a2a2a;
-      border: 1px solid #444;
-      border-radius: var(--border-radius);
-      color: var(--text);
-      font-size: 16px;
-    }
-    
-    .button {
-      display: block;
-      width: 100%;
-      padding: 15px;
-      background: linear-gradient(135deg, var(--primary) 0%, var(--primary-light) 100%);
-      color: white;
-      border: none;
-      border-radius: var(--border-radius);
-      font-size: 16px;
-      font-weight: 600;
-      cursor: pointer;
-      transition: var(--transition);
-      text-transform: uppercase;
-      letter-spacing: 1px;
-      text-align: center;
-      text-decoration: none;
-      margin-top: 20px;
-    }
-    
-    .button:hover {
-      transform: translateY(-3px);
-      box-shadow: 0 8px 20px rgba(33, 150, 243, 0.4);
-    }
-    
-    .button-danger {
-      background: linear-gradient(135deg, var(--danger) 0%, #FF7043 100%);
-    }
-    
-    .footer {
-      text-align: center;
-      padding: 15px 0;
-      margin-top: 30px;
-      font-size: 12px;
-      color: var(--text-secondary);
-    }
-    
-    a.button-back {
-      display: inline-block;
-      padding: 10px 20px;
-      margin-bottom: 20px;
-      background: #333;
-      color: white;
-      text-decoration: none;
-      border-radius: var(--border-radius);
-      font-size: 14px;
-    }
-    
-    a.button-back:hover {
-      background: #444;
-    }
-    
-    .network-list {
-      margin-bottom: 20px;
-    }
-    
-    .network-item {
-      display: flex;
-      align-items: center;
-      padding: 12px;
-      background: #1a1a1a;
-      border-radius: var(--border-radius);
-      margin-bottom: 8px;
-      cursor: pointer;
-      transition: var(--transition);
-    }
-    
-    .network-item:hover {
-      background: #252525;
-    }
-    
-    .network-item.selected {
-      background: #253a4f;
-      border: 1px solid var(--primary);
-    }
-    
-    .network-info {
-      flex: 1;
-    }
-    
-    .network-name {
-      font-size: 15px;
-      font-weight: 500;
-    }
-    
-    .network-details {
-      display: flex;
-      align-items: center;
-      font-size: 12px;
-      color: var(--text-secondary);
-      margin-top: 3px;
-    }
-    
-    .signal-strength {
-      display: flex;
-      margin-right: 10px;
-    }
-    
-    .signal-bar {
-      width: 3px;
-      margin-right: 2px;
-      background: var(--primary-light);
-      border-radius: 1px;
-    }
-    
-    .signal-bar.active {
-      opacity: 1;
-    }
-    
-    .signal-bar.inactive {
-      opacity: 0.3;
-    }
-    
-    .security-icon {
-      margin-left: auto;
-      width: 16px;
-      height: 16px;
-      display: flex;
-      align-items: center;
-      justify-content: center;
-    }
-    
-    .spinner {
-      width: 20px;
-      height: 20px;
-      border: 2px solid rgba(33, 150, 243, 0.3);
-      border-radius: 50%;
-      border-top-color: var(--primary);
-      animation: spin 1s linear infinite;
-      margin-right: 10px;
-    }
-    
-    @keyframes spin {
-      to { transform: rotate(360deg); }
-    }
-  </style>
-</head>
-<body>
-  <div class="container">
-    <a href="/" class="button-back">&larr;Back to Dashboard</a>
-    
-    <div class="card">
-      <div class="card-header">
-        <h1>Network Settings</h1>
-        <p>Configure WiFi connection</p>
-      </div>
-      
-      <div class="card-content">
-        <div class="status-container">
-          <div class="status-item">
-            <span class="status-label">Current Mode:</span>
-            <span class="status-value" id="currentMode">)rawliteral";
-            
-    html += modeText;
-    
-    html += R"rawliteral(</span>
-          </div>
-          <div class="status-item">
-            <span class="status-label">IP Address:</span>
-            <span class="status-value" id="ipAddress">)rawliteral";
-            
-    html += ipAddress;
-    
-    html += R"rawliteral(</span>
-          </div>
-        </div>
-        
-        <div class="network-section">
-          <h3>Available Networks</h3>
-          <div class="network-list" id="networkList">
-            <div style="display:flex; align-items:center; justify-content:center; padding:20px;">
-              <div class="spinner"></div>
-              <span>Scanning for networks...</span>
-            </div>
-          </div>
-        </div>
-        
-        <form action="/network" method="GET" id="wifiForm">
-          <div class="form-row">
-            <label for="ssid" class="form-label">WiFi Network Name (SSID)</label>
-            <input type="text" id="ssid" name="ssid" class="form-input" required>
-          </div>
-          
-          <div class="form-row">
-            <label for="password" class="form-label">WiFi Password</label>
-            <input type="password" id="password" name="password" class="form-input">
-          </div>
-
-          <div class="form-row">
-            <label for="deviceName" class="form-label">Device Name</label>
-            <input type="text" id="deviceName" name="deviceName" class="form-input" required>
-          </div>
-          
-          <button type="submit" class="button">Save and Connect</button>
-        </form>
-        
-        <a href="/resetwifi" class="button button-danger" onclick="return confirm('Are you sure you want to reset all network settings? The device will restart in AP mode.')">Reset Network Settings</a>
-      </div>
-    </div>
-  </div>
-  
-    <div class="footer">
-      <p>AquaLevel v1.0 | ESP32 + Ultrasonic Sensor | Copyright © 2025</p>
-    </div>
-  
-  <script>
-    // Scan for networks when page loads
-    document.addEventListener('DOMContentLoaded', function() {
-      scanNetworks();
-    });
-    
-    function scanNetworks() {
-      const networkList = document.getElementById('networkList');
-      
-      fetch('/scannetworks')
-        .then(response => response.json())
-        .then(networks => {
-          if (networks.length === 0) {
-            networkList.innerHTML = '<p>No networks found. <a href="#" onclick="scanNetworks(); return false;">Scan again</a></p>';
-            return;
-          }
-          
-          // Clear current list
-          networkList.innerHTML = '';
-          
-          // Add each network to the list
-          networks.forEach(network => {
-            const networkItem = document.createElement('div');
-            networkItem.className = 'network-item';
-            networkItem.onclick = function() {
-              selectNetwork(network.ssid);
-            };
-            
-            // Calculate signal strength (0-4 bars)
-            const signalStrength = calculateSignalStrength(network.rssi);
-            
-            networkItem.innerHTML = `
-              <div class="network-info">
-                <div class="network-name">${network.ssid}</div>
-                <div class="network-details">
-                  <div class="signal-strength">
-                    ${generateSignalBars(signalStrength)}
-                  </div>
-                  <span>${network.secure ? 'Secure' : 'Open'}</span>
-                </div>
-              </div>
-              <div class="security-icon">
-                ${network.secure ? '<span>🔒</span>' : '<span>🔓</span>'}
-              </div>
-            `;
-            
-            networkList.appendChild(networkItem);
-          });
-        })
-        .catch(error => {
-          console.error('Error scanning networks:', error);
-          networkList.innerHTML = '<p>Error scanning networks. <a href="#" onclick="scanNetworks(); return false;">Try again</a></p>';
-        });
-    }
-    
-    function calculateSignalStrength(rssi) {
-      // RSSI to signal bars conversion (typically -30 to -90 dBm)
-      if (rssi >= -50) return 4;      // Excellent
-      else if (rssi >= -60) return 3; // Good
-      else if (rssi >= -70) return 2; // Fair
-      else if (rssi >= -80) return 1; // Poor
-      else return 0;                  // Very poor
-    }
-    
-    function generateSignalBars(strength) {
-      let bars = '';
-      
-      for (let i = 0; i < 4; i++) {
-        const barHeight = 5 + (i * 3);
-        const barClass = i < strength ? 'active' : 'inactive';
-        bars += `<div class="signal-bar ${barClass}" style="height: ${barHeight}px"></div>`;
-      }
-      
-      return bars;
-    }
-    
-    function selectNetwork(ssid) {
-      // Set the SSID in the form
-      document.getElementById('ssid').value = ssid;
-      
-      // Highlight the selected network
-      const networkItems = document.querySelectorAll('.network-item');
-      networkItems.forEach(item => {
-        const networkName = item.querySelector('.network-name').textContent;
-        if (networkName === ssid) {
-          item.classList.add('selected');
-        } else {
-          item.classList.remove('selected');
-        }
-      });
-    }
-  </script>
-</body>
-</html>
-    )rawliteral";
-    
-    server.send(200, "text/html", html);
-  }
-}
+    // Stream the network settings form from flash, filling in the live fields
+    sendTemplate(request, NETWORK_TEMPLATE, NETWORK_TEMPLATE_LENGTH, networkTemplateField);
+  }
+}
 
 // Render the tank settings page
-void handleSettingsPage() {
-  const char* html = R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-  <title>Tank Settings - AquaLevel Monitor</title>
-  <meta name='viewport' content='width=device-width, initial-scale=1'>
-  <style>
-    :root {
-      --primary: #2196F3;
-      --primary-light: #64B5F6;
-      --primary-dark: #1976D2;
-      --secondary: #03A9F4;
-      --accent: #00BCD4;
-      --success: #4CAF50;
-      --warning: #FFC107;
-      --danger: #F44336;
-      --bg-dark: #121212;
-      --bg-card: #1e1e1e;
-      --text: #ffffff;
-      --text-secondary: #b0b0b0;
-      --border-radius: 12px;
-      --shadow: 0 10px 20px rgba(0,0,0,0.3);
-      --transition: all 0.3s ease;
-    }
-    
-    * {
-      margin: 0;
-      padding: 0;
-      box-sizing: border-box;
-    }
-    
-    body {
-      font-family: 'Segoe UI', Tahoma, Geneva, Verdana, sans-serif;
-      background-color: var(--bg-dark);
-      color: var(--text);
-      min-height: 100vh;
-      display: flex;
-      flex-direction: column;
-      padding: 20px;
-      background: linear-gradient(135deg, #121212 0%, #2a2a2a 100%);
-    }
-    
-    .container {
-      width: 100%;
-      max-width: 900px;
-      margin: 0 auto;
-      display: flex;
-      flex-direction: column;
-      gap: 20px;
-    }
-    
-    .card {
-      background: var(--bg-card);
-      border-radius: var(--border-radius);
-      box-shadow: var(--shadow);
-      overflow: hidden;
-    }
-    
-    .card-header {
-      background: linear-gradient(135deg, var(--primary) 0%, var(--primary-light) 100%);
-      padding: 20px;
-      text-align: center;
-    }
-    
-    .card-header h1 {
-      font-size: 24px;
-      font-weight: 600;
-      margin-bottom: 8px;
-      text-shadow: 0 2px 5px rgba(0,0,0,0.2);
-    }
-    
-    .card-header p {
-      opacity: 0.9;
-      font-size: 14px;
-    }
-    
-    .card-content {
-      padding: 20px;
-    }
-    
-    .tab-container {
-      display: flex;
-      margin-bottom: 20px;
-      border-bottom: 1px solid #333;
-    }
-
-    .tab {
-      padding: 10px 15px;
-      cursor: pointer;
-      background-color: transparent;
-      border: none;
-      color: var(--text-secondary);
-      font-size: 14px;
-      position: relative;
-    }
-
-    .tab.active {
-      color: var(--primary);
-    }
-
-    .tab.active::after {
-      content: '';
-      position: absolute;
-      bottom: -1px;
-      left: 0;
-      width: 100%;
-      height: 2px;
-      background-color: var(--primary);
-    }
-    
-    .form-row {
-      margin-bottom: 20px;
-    }
-    
-    .form-label {
-      display: block;
-      margin-bottom: 8px;
-      font-size: 14px;
-      color: var(--text-secondary);
-    }
-    
-    .form-input {
-      width: 100%;
-      padding: 12px;
-      background: #2a2a2a;
-      border: 1px solid #444;
-      border-radius: var(--border-radius);
-      color: var(--text);
-      font-size: 16px;
-    }
-    
-    .input-group {
-      display: flex;
-      align-items: center;
-    }
-    
-    .input-group .form-input {
-      flex: 1;
-      border-top-right-radius: 0;
-      border-bottom-right-radius: 0;
-    }
-    
-    .input-group-append {
-      background: #444;
-      padding: 12px 15px;
-      border-top-right-radius: var(--border-radius);
-      border-bottom-right-radius: var(--border-radius);
-      color: var(--text-secondary);
-    }
-    
-    .toggle-switch {
-      position: relative;
-      display: inline-block;
-      width: 60px;
-      height: 34px;
-    }
-
-    .toggle-switch input {
-      opacity: 0;
-      width: 0;
-      height: 0;
-    }
-
-    .toggle-slider {
-      position: absolute;
-      cursor: pointer;
-      top: 0;
-      left: 0;
-      right: 0;
-      bottom: 0;
-      background-color: #333;
-      transition: .4s;
-      border-radius: 34px;
-    }
-
-    .toggle-slider:before {
-      position: absolute;
-      content: "";
-      height: 26px;
-      width: 26px;
-      left: 4px;
-      bottom: 4px;
-      background-color: white;
-      transition: .4s;
-      border-radius: 50%;
-    }
-
-    input:checked + .toggle-slider {
-      background-color: var(--primary);
-    }
-
-    input:checked + .toggle-slider:before {
-      transform: translateX(26px);
-    }
-    
-    .toggle-container {
-      display: flex;
-      justify-content: space-between;
-      align-items: center;
-      margin-bottom: 20px;
-    }
-    
-    .toggle-label {
-      font-size: 14px;
-      color: var(--text-secondary);
-    }
-    
-    .tab-content {
-      display: none;
-    }
-    
-    .tab-content.active {
-      display: block;
-    }
-    
-    .footer {
-      text-align: center;
-      padding: 15px 0;
-      margin-top: 30px;
-      font-size: 12px;
-      color: var(--text-secondary);
-    }
-    
-    .button {
-      display: block;
-      width: 100%;
-      padding: 15px;
-      background: linear-gradient(135deg, var(--primary) 0%, var(--primary-light) 100%);
-      color: white;
-      border: none;
-      border-radius: var(--border-radius);
-      font-size: 16px;
-      font-weight: 600;
-      cursor: pointer;
-      transition: var(--transition);
-      text-transform: uppercase;
-      letter-spacing: 1px;
-      text-align: center;
-      text-decoration: none;
-      margin-top: 20px;
-    }
-    
-    .button:hover {
-      transform: translateY(-3px);
-      box-shadow: 0 8px 20px rgba(33, 150, 243, 0.4);
-    }
-    
-    .button-secondary {
-      background: linear-gradient(135deg, var(--secondary) 0%, var(--accent) 100%);
-    }
-    
-    .button-success {
-      background: linear-gradient(135deg, var(--success) 0%, #81C784 100%);
-    }
-    
-    a.button-back {
-      display: inline-block;
-      padding: 10px 20px;
-      margin-bottom: 20px;
-      background: #333;
-      color: white;
-      text-decoration: none;
-      border-radius: var(--border-radius);
-      font-size: 14px;
-    }
-    
-    a.button-back:hover {
-      background: #444;
-    }
-  </style>
-</head>
-<body>
-  <div class="container">
-    <a href="/" class="button-back">&larr; Back to Dashboard</a>
-    
-    <div class="card">
-      <div class="card-header">
-        <h1>Tank Settings</h1>
-        <p>Configure your water tank parameters</p>
-      </div>
-      
-      <div class="card-content">
-        <div class="tab-container">
-          <button class="tab active" data-tab="tankSettings">Tank Dimensions</button>
-          <button class="tab" data-tab="alertSettings">Alert Settings</button>
-          <button class="tab" data-tab="sensorSettings">Sensor Calibration</button>
-        </div>
-        
-        <!-- Tank Dimensions Settings -->
-        <div id="tankSettings" class="tab-content active">
-          <form action="/set" method="GET">
-            <div class="form-row">
-              <label for="tankHeight" class="form-label">Tank Height</label>
-              <div class="input-group">
-                <input type="number" id="tankHeight" name="tankHeight" class="form-input" step="0.1" min="10" max="1000">
-                <div class="input-group-append">cm</div>
-              </div>
-            </div>
-            
-            <div class="form-row">
-              <label for="tankDiameter" class="form-label">Tank Diameter</label>
-              <div class="input-group">
-                <input type="number" id="tankDiameter" name="tankDiameter" class="form-input" step="0.1" min="10" max="500">
-                <div class="input-group-append">cm</div>
-              </div>
-            </div>
-            
-            <div class="form-row">
-              <label for="tankVolume" class="form-label">Tank Volume</label>
-              <div class="input-group">
-                <input type="number" id="tankVolume" name="tankVolume" class="form-input" step="0.1" min="1" max="10000">
-                <div class="input-group-append">liters</div>
-              </div>
-            </div>
-            
-            <button type="submit" class="button button-success">Save Tank Settings</button>
-          </form>
-        </div>
-        
-        <!-- Alert Settings -->
-        <div id="alertSettings" class="tab-content">
-          <form action="/set" method="GET">
-            <div class="form-row">
-              <label for="alertLevelLow" class="form-label">Low Water Alert Level</label>
-              <div class="input-group">
-                <input type="number" id="alertLevelLow" name="alertLevelLow" class="form-input" min="0" max="100">
-                <div class="input-group-append">%</div>
-              </div>
-            </div>
-            
-            <div class="form-row">
-              <label for="alertLevelHigh" class="form-label">High Water Alert Level</label>
-              <div class="input-group">
-                <input type="number" id="alertLevelHigh" name="alertLevelHigh" class="form-input" min="0" max="100">
-                <div class="input-group-append">%</div>
-              </div>
-            </div>
-            
-            <div class="toggle-container">
-              <span class="toggle-label">Enable Alerts</span>
-              <label class="toggle-switch">
-                <input type="checkbox" id="alertsEnabled" name="alertsEnabled" value="true">
-                <span class="toggle-slider"></span>
-              </label>
-            </div>
-            
-            <button type="submit" class="button button-success">Save Alert Settings</button>
-          </form>
-        </div>
-        
-        <!-- Sensor Settings -->
-        <div id="sensorSettings" class="tab-content">
-          <form action="/set" method="GET">
-            <div class="form-row">
-              <label for="sensorOffset" class="form-label">Sensor Offset (distance from sensor to max water level)</label>
-              <div class="input-group">
-                <input type="number" id="sensorOffset" name="sensorOffset" class="form-input" step="0.1" min="0" max="100">
-                <div class="input-group-append">cm</div>
-              </div>
-            </div>
-            
-            <div class="form-row">
-              <label for="emptyDistance" class="form-label">Empty Tank Distance (from sensor to bottom)</label>
-              <div class="input-group">
-                <input type="number" id="emptyDistance" name="emptyDistance" class="form-input" step="0.1" min="10" max="500">
-                <div class="input-group-append">cm</div>
-              </div>
-            </div>
-            
-            <div class="form-row">
-              <label for="fullDistance" class="form-label">Full Tank Distance (from sensor to water when full)</label>
-              <div class="input-group">
-                <input type="number" id="fullDistance" name="fullDistance" class="form-input" step="0.1" min="0" max="100">
-                <div class="input-group-append">cm</div>
-              </div>
-            </div>
-            
-            <div class="form-row">
-              <label for="measurementInterval" class="form-label">Measurement Interval</label>
-              <div class="input-group">
-                <input type="number" id="measurementInterval" name="measurementInterval" class="form-input" min="1" max="60">
-                <div class="input-group-append">seconds</div>
-              </div>
-            </div>
-            
-            <div class="form-row">
-              <label for="readingSmoothing" class="form-label">Reading Smoothing (number of readings to average)</label>
-              <div class="input-group">
-                <input type="number" id="readingSmoothing" name="readingSmoothing" class="form-input" min="1" max="50">
-                <div class="input-group-append">readings</div>
-              </div>
-            </div>
-            
-            <button type="submit" class="button button-success">Save Sensor Settings</button>
-          </form>
-        </div>
-      </div>
-    </div>
-  </div>
-  
-  <div class="footer">
-    <p>Water Tank Monitor | ESP32 + HC-SR04 Ultrasonic Sensor</p>
-  </div>
-  
-  <script>
-    // Fetch current settings when page loads
-    document.addEventListener('DOMContentLoaded', function() {
-      fetchSettings();
-      setupTabHandlers();
-    });
-    
-    function setupTabHandlers() {
-      const tabs = document.querySelectorAll('.tab');
-      
-      tabs.forEach(tab => {
-        tab.addEventListener('click', function() {
-          // Remove active class from all tabs
-          tabs.forEach(t => t.classList.remove('active'));
-          
-          // Add active class to clicked tab
-          this.classList.add('active');
-          
-          // Hide all tab content
-          document.querySelectorAll('.tab-content').forEach(content => {
-            content.classList.remove('active');
-          });
-          
-          // Show selected tab content
-          const tabId = this.getAttribute('data-tab');
-          document.getElementById(tabId).classList.add('active');
-        });
-      });
-    }
-    
-    function fetchSettings() {
-      fetch('/settings')
-        .then(response => response.json())
-        .then(settings => {
-          // Populate form fields with current settings
-          document.getElementById('tankHeight').value = settings.tankHeight;
-          document.getElementById('tankDiameter').value = settings.tankDiameter;
-          document.getElementById('tankVolume').value = settings.tankVolume;
-          document.getElementById('sensorOffset').value = settings.sensorOffset;
-          document.getElementById('emptyDistance').value = settings.emptyDistance;
-          document.getElementById('fullDistance').value = settings.fullDistance;
-          document.getElementById('measurementInterval').value = settings.measurementInterval;
-          document.getElementById('readingSmoothing').value = settings.readingSmoothing;
-          document.getElementById('alertLevelLow').value = settings.alertLevelLow;
-          document.getElementById('alertLevelHigh').value = settings.alertLevelHigh;
-          document.getElementById('alertsEnabled').checked = settings.alertsEnabled;
-        })
-        .catch(error => {
-          console.error('Error fetching settings:', error);
-        });
-    }
-  </script>
-</body>
-</html>
-  )rawliteral";
-  
-  server.send(200, "text/html", html);
+void handleSettingsPage(AsyncWebServerRequest* request) {
+  sendAsset(request, "/settings.html");
 }
 // Enhanced Web Interface - Root page with dashboard
-void handleRoot() {
-  const char* html = R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-  <title>AquaLevel v1.0</title>
-  <meta name='viewport' content='width=device-width, initial-scale=1'>
-  <style>
-    :root {
-      --primary: #2196F3;
-      --primary-light: #64B5F6;
-      --primary-dark: #1976D2;
-      --secondary: #03A9F4;
-      --accent: #00BCD4;
-      --success: #4CAF50;
-      --warning: #FFC107;
-      --danger: #F44336;
-      --bg-dark: #121212;
-      --bg-card: #1e1e1e;
-      --text: #ffffff;
-      --text-secondary: #b0b0b0;
-      --border-radius: 12px;
-      --shadow: 0 10px 20px rgba(0,0,0,0.3);
-      --transition: all 0.3s ease;
-    }
-    
-    * {
-      margin: 0;
-      padding: 0;
-      box-sizing: border-box;
-    }
-    
-    body {
-      font-family: 'Segoe UI', Tahoma, Geneva, Verdana, sans-serif;
-      background-color: var(--bg-dark);
-      color: var(--text);
-      min-height: 100vh;
-      display: flex;
-      flex-direction: column;
-      justify-content: space-between;
-      padding: 20px;
-      background: linear-gradient(135deg, #121212 0%, #2a2a2a 100%);
-    }
-    
-    .main-content {
-      display: flex;
-      justify-content: center;
-      align-items: center;
-      flex: 1;
-    }
-    
-    .container {
-      width: 100%;
-      max-width: 900px;
-      display: flex;
-      flex-direction: column;
-      gap: 20px;
-    }
-    
-    .card {
-      background: var(--bg-card);
-      border-radius: var(--border-radius);
-      box-shadow: var(--shadow);
-      overflow: hidden;
-      position: relative;
-    }
-    
-    .card-header {
-      background: linear-gradient(135deg, var(--primary) 0%, var(--primary-light) 100%);
-      padding: 20px;
-      text-align: center;
-      position: relative;
-    }
-    
-    .card-header h1 {
-      font-size: 24px;
-      font-weight: 600;
-      margin-bottom: 8px;
-      text-shadow: 0 2px 5px rgba(0,0,0,0.2);
-    }
-    
-    .card-header p {
-      opacity: 0.9;
-      font-size: 14px;
-    }
-    
-    .grid {
-      display: grid;
-      grid-template-columns: 1fr;
-      gap: 20px;
-      padding: 20px;
-    }
-    
-    @media (min-width: 768px) {
-      .grid {
-        grid-template-columns: 1fr 1fr;
-      }
-    }
-    
-    .tank-container {
-      display: flex;
-      flex-direction: column;
-      align-items: center;
-      justify-content: center;
-      background: #1a1a1a;
-      border-radius: var(--border-radius);
-      padding: 20px;
-      min-height: 400px;
-    }
-    
-    .tank-visualization {
-      width: 200px;
-      height: 300px;
-      position: relative;
-      border: 8px solid #444;
-      border-top: none;
-      border-bottom-left-radius: 20px;
-      border-bottom-right-radius: 20px;
-      overflow: hidden;
-      margin-bottom: 20px;
-      background: rgba(0, 0, 0, 0.2);
-    }
-    
-    /* Tank top lid */
-    .tank-visualization::before {
-      content: '';
-      position: absolute;
-      top: -10px;
-      left: -8px;
-      width: calc(100% + 16px);
-      height: 10px;
-      background: #444;
-      border-top-left-radius: 10px;
-      border-top-right-radius: 10px;
-    }
-    
-    .water {
-      position: absolute;
-      bottom: 0;
-      left: 0;
-      width: 100%;
-      background: linear-gradient(180deg, var(--primary-light) 0%, var(--primary-dark) 100%);
-      transition: height 1s cubic-bezier(0.23, 1, 0.32, 1);
-      border-top-left-radius: 6px;
-      border-top-right-radius: 6px;
-      overflow: hidden;
-    }
-    
-    /* Water wave effect */
-    .water::after {
-      content: '';
-      position: absolute;
-      top: 0;
-      left: 0;
-      width: 200%;
-      height: 10px;
-      background: rgba(255, 255, 255, 0.3);
-      border-radius: 50%;
-      animation: wave 3s infinite linear;
-    }
-    
-    @keyframes wave {
-      0% {
-        transform: translateX(-50%) scale(1);
-      }
-      50% {
-        transform: translateX(0%) scale(1.2);
-      }
-      100% {
-        transform: translateX(-50%) scale(1);
-      }
-    }
-    
-    .level-markers {
-      position: absolute;
-      left: -40px;
-      top: 0;
-      height: 100%;
-      width: 30px;
-      display: flex;
-      flex-direction: column;
-      justify-content: space-between;
-      padding: 10px 0;
-    }
-    
-    .level-marker {
-      display: flex;
-      align-items: center;
-      font-size: 12px;
-      color: var(--text-secondary);
-    }
-    
-    .level-marker::before {
-      content: '';
-      display: block;
-      width: 20px;
-      height: 1px;
-      background: var(--text-secondary);
-      margin-right: 5px;
-    }
-    
-    .alert-indicator {
-      position: absolute;
-      top: 5px;
-      right: -35px;
-      display: flex;
-      flex-direction: column;
-      gap: 10px;
-    }
-    
-    .alert-marker {
-      width: 30px;
-      height: 4px;
-      background: var(--danger);
-      opacity: 0.4;
-    }
-    
-    .alert-marker.high {
-      background: var(--danger);
-    }
-    
-    .alert-marker.low {
-      background: var(--warning);
-    }
-    
-    .alert-marker.active {
-      opacity: 1;
-      animation: blink 1s infinite;
-    }
-    
-    @keyframes blink {
-      0%, 100% { opacity: 1; }
-      50% { opacity: 0.5; }
-    }
-    
-    .tank-info {
-      display: flex;
-      flex-direction: column;
-      align-items: center;
-      gap: 10px;
-    }
-    
-.info-value {
-      font-size: 40px;
-      font-weight: 700;
-      color: var(--primary);
-      text-shadow: 0 0 10px rgba(33, 150, 243, 0.4);
-    }
-    
-    .info-label {
-      font-size: 14px;
-      color: var(--text-secondary);
-    }
-    
-    .stats-grid {
-      display: grid;
-      grid-template-columns: repeat(2, 1fr);
-      gap: 15px;
-    }
-    
-    .stat-card {
-      background: #1a1a1a;
-      border-radius: var(--border-radius);
-      padding: 15px;
-      display: flex;
-      flex-direction: column;
-      align-items: center;
-      text-align: center;
-    }
-    
-    .stat-value {
-      font-size: 24px;
-      font-weight: 600;
-      margin-top: 5px;
-      color: var(--primary-light);
-    }
-    
-    .stat-label {
-      font-size: 12px;
-      color: var(--text-secondary);
-    }
-    
-    .controls {
-      display: flex;
-      flex-direction: column;
-      gap: 15px;
-    }
-    
-    .button {
-      display: block;
-      width: 100%;
-      padding: 15px;
-      background: linear-gradient(135deg, var(--primary) 0%, var(--primary-light) 100%);
-      color: white;
-      border: none;
-      border-radius: var(--border-radius);
-      font-size: 16px;
-      font-weight: 600;
-      cursor: pointer;
-      transition: var(--transition);
-      text-transform: uppercase;
-      letter-spacing: 1px;
-      text-align: center;
-      text-decoration: none;
-    }
-    
-    .button:hover {
-      transform: translateY(-3px);
-      box-shadow: 0 8px 20px rgba(33, 150, 243, 0.4);
-    }
-    
-    .button-secondary {
-      background: linear-gradient(135deg, var(--secondary) 0%, var(--accent) 100%);
-    }
-    
-    .button-danger {
-      background: linear-gradient(135deg, var(--danger) 0%, #FF7043 100%);
-    }
-    
-    .button-success {
-      background: linear-gradient(135deg, var(--success) 0%, #81C784 100%);
-    }
-    
-    .button-warning {
-      background: linear-gradient(135deg, var(--warning) 0%, #FFCA28 100%);
-    }
-    
-    .calibration-card {
-      margin-top: 20px;
-    }
-    
-    .calibration-title {
-      font-size: 16px;
-      font-weight: 600;
-      margin-bottom: 10px;
-      text-align: center;
-    }
-    
-    .calibration-buttons {
-      display: flex;
-      gap: 10px;
-    }
-    
-    .loading-overlay {
-      position: fixed;
-      top: 0;
-      left: 0;
-      right: 0;
-      bottom: 0;
-      background: rgba(0, 0, 0, 0.7);
-      display: flex;
-      justify-content: center;
-      align-items: center;
-      z-index: 1000;
-    }
-    
-    .spinner {
-      width: 50px;
-      height: 50px;
-      border: 5px solid rgba(255, 255, 255, 0.1);
-      border-radius: 50%;
-      border-top-color: var(--primary);
-      animation: spin 1s linear infinite;
-    }
-    
-    @keyframes spin {
-      to { transform: rotate(360deg); }
-    }
-    
-    .notification {
-      position: fixed;
-      top: 20px;
-      right: 20px;
-      padding: 15px 25px;
-      background: linear-gradient(135deg, var(--success) 0%, #81C784 100%);
-      color: white;
-      border-radius: var(--border-radius);
-      transform: translateX(calc(100% + 20px));
-      transition: transform 0.3s ease;
-      box-shadow: 0 5px 15px rgba(0, 0, 0, 0.2);
-      z-index: 1000;
-    }
-    
-    .notification.error {
-      background: linear-gradient(135deg, var(--danger) 0%, #FF7043 100%);
-    }
-    
-    .notification.show {
-      transform: translateX(0);
-    }
-    
-    .footer {
-      text-align: center;
-      padding: 15px 0;
-      margin-top: 30px;
-      font-size: 12px;
-      color: var(--text-secondary);
-      width: 100%;
-    }
-    
-    .tab-container {
-      display: flex;
-      margin-bottom: 20px;
-      border-bottom: 1px solid #333;
-    }
-
-    .tab {
-      padding: 10px 15px;
-      cursor: pointer;
-      background-color: transparent;
-      border: none;
-      color: var(--text-secondary);
-      font-size: 14px;
-      position: relative;
-    }
-
-    .tab.active {
-      color: var(--primary);
-    }
-
-    .tab.active::after {
-      content: '';
-      position: absolute;
-      bottom: -1px;
-      left: 0;
-      width: 100%;
-      height: 2px;
-      background-color: var(--primary);
-    }
-    
-    /* Tank Settings Form */
-    .form-row {
-      margin-bottom: 20px;
-    }
-    
-    .form-label {
-      display: block;
-      margin-bottom: 8px;
-      font-size: 14px;
-      color: var(--text-secondary);
-    }
-    
-    .form-input {
-      width: 100%;
-      padding: 12px;
-      background: #2a2a2a;
-      border: 1px solid #444;
-      border-radius: var(--border-radius);
-      color: var(--text);
-      font-size: 16px;
-    }
-    
-    .input-group {
-      display: flex;
-      align-items: center;
-    }
-    
-    .input-group .form-input {
-      flex: 1;
-      border-top-right-radius: 0;
-      border-bottom-right-radius: 0;
-    }
-    
-    .input-group-append {
-      background: #444;
-      padding: 12px 15px;
-      border-top-right-radius: var(--border-radius);
-      border-bottom-right-radius: var(--border-radius);
-      color: var(--text-secondary);
-    }
-    
-    .toggle-switch {
-      position: relative;
-      display: inline-block;
-      width: 60px;
-      height: 34px;
-    }
-
-    .toggle-switch input {
-      opacity: 0;
-      width: 0;
-      height: 0;
-    }
-
-    .toggle-slider {
-      position: absolute;
-      cursor: pointer;
-      top: 0;
-      left: 0;
-      right: 0;
-      bottom: 0;
-      background-color: #333;
-      transition: .4s;
-      border-radius: 34px;
-    }
-
-    .toggle-slider:before {
-      position: absolute;
-      content: "";
-      height: 26px;
-      width: 26px;
-      left: 4px;
-      bottom: 4px;
-      background-color: white;
-      transition: .4s;
-      border-radius: 50%;
-    }
-
-    input:checked + .toggle-slider {
-      background-color: var(--primary);
-    }
-
-    input:checked + .toggle-slider:before {
-      transform: translateX(26px);
-    }
-    
-    /* Settings page specific */
-    .toggle-container {
-      display: flex;
-      justify-content: space-between;
-      align-items: center;
-      margin-bottom: 20px;
-    }
-    
-    .toggle-label {
-      font-size: 14px;
-      color: var(--text-secondary);
-    }
-    
-    #tankSettingsForm, #alertSettingsForm, #networkSettingsForm {
-      display: none;
-    }
-    
-    #tankSettingsForm.active, #alertSettingsForm.active, #networkSettingsForm.active {
-      display: block;
-    }
-  </style>
-</head>
-<body>
-  <div class="loading-overlay" id="loadingOverlay">
-    <div class="spinner"></div>
-  </div>
-
-  <div class="notification" id="notification">
-    Settings saved successfully!
-  </div>
-
-  <div class="main-content">
-    <div class="container">
-      <div class="card">
-        <div class="card-header">
-          <h1>AquaLevel Monitor</h1>
-          <p>Real-time water level monitoring system</p>
-        </div>
-        
-        <div class="grid">
-          <div class="tank-container">
-            <div class="tank-visualization">
-              <div class="water" id="water" style="height: 0%;"></div>
-              
-              <div class="level-markers">
-                <div class="level-marker">100%</div>
-                <div class="level-marker">75%</div>
-                <div class="level-marker">50%</div>
-                <div class="level-marker">25%</div>
-                <div class="level-marker">0%</div>
-              </div>
-              
-              <div class="alert-indicator">
-                <div class="alert-marker high" id="highAlert"></div>
-                <div class="alert-marker low" id="lowAlert"></div>
-              </div>
-            </div>
-            
-            <div class="tank-info">
-              <div class="info-value" id="percentageDisplay">--.-</div>
-              <div class="info-label">Water Level</div>
-            </div>
-          </div>
-          
-          <div class="stats-container">
-            <div class="stats-grid">
-              <div class="stat-card">
-                <div class="stat-label">Current Volume</div>
-                <div class="stat-value" id="volumeDisplay">--.-</div>
-                <div class="stat-label">liters</div>
-              </div>
-              <div class="stat-card">
-                <div class="stat-label">Tank Capacity</div>
-                <div class="stat-value" id="capacityDisplay">--.-</div>
-                <div class="stat-label">liters</div>
-              </div>
-              <div class="stat-card">
-                <div class="stat-label">Water Level</div>
-                <div class="stat-value" id="levelDisplay">--.-</div>
-                <div class="stat-label">cm</div>
-              </div>
-              <div class="stat-card">
-                <div class="stat-label">Measured Distance</div>
-                <div class="stat-value" id="distanceDisplay">--.-</div>
-                <div class="stat-label">cm</div>
-              </div>
-            </div>
-            
-            <div class="controls">
-              <a href="/settings.html" class="button">Tank Settings</a>
-              <a href="/network" class="button button-secondary">Network Settings</a>
-            </div>
-            
-            <div class="calibration-card">
-              <div class="calibration-title">Quick Calibration</div>
-              <div class="calibration-buttons">
-                <button class="button button-warning" id="calibrateEmptyBtn">Calibrate Empty</button>
-                <button class="button button-success" id="calibrateFullBtn">Calibrate Full</button>
-              </div>
-            </div>
-          </div>
-        </div>
-      </div>
-    </div>
-  </div>
-  
-  <div class="footer">
-    <p>Water Tank Monitor | ESP32 + HC-SR04 Ultrasonic Sensor</p>
-  </div>
-  
-  <script>
-    // DOM Elements
-    const waterEl = document.getElementById('water');
-    const percentageDisplay = document.getElementById('percentageDisplay');
-    const volumeDisplay = document.getElementById('volumeDisplay');
-    const capacityDisplay = document.getElementById('capacityDisplay');
-    const levelDisplay = document.getElementById('levelDisplay');
-    const distanceDisplay = document.getElementById('distanceDisplay');
-    const highAlert = document.getElementById('highAlert');
-    const lowAlert = document.getElementById('lowAlert');
-    const loadingOverlay = document.getElementById('loadingOverlay');
-    const notification = document.getElementById('notification');
-    const calibrateEmptyBtn = document.getElementById('calibrateEmptyBtn');
-    const calibrateFullBtn = document.getElementById('calibrateFullBtn');
-    
-    // Initialize data
-    let tankData = {
-      percentage: 0,
-      volume: 0,
-      waterLevel: 0,
-      distance: 0,
-      tankVolume: 0,
-      alertLevelLow: 0,
-      alertLevelHigh: 0,
-      alertsEnabled: true
-    };
-    
-    // Load initial data
-    window.addEventListener('load', function() {
-      fetchTankData();
-      // Hide loading overlay after data is loaded
-      setTimeout(function() {
-        loadingOverlay.style.display = 'none';
-      }, 1000);
-    });
-    
-    // Setup periodic refresh
-    setInterval(fetchTankData, 2000);
-    
-    // Fetch tank data from the API
-    function fetchTankData() {
-      fetch('/tank-data')
-        .then(response => response.json())
-        .then(data => {
-          tankData = data;
-          updateUI();
-        })
-        .catch(error => {
-          console.error('Error fetching tank data:', error);
-        });
-    }
-    
-    // Update UI with current data
-    function updateUI() {
-      // Update water level visualization
-      waterEl.style.height = tankData.percentage + '%';
-      
-      // Update displays
-      percentageDisplay.textContent = tankData.percentage.toFixed(1) + '%';
-      volumeDisplay.textContent = tankData.volume.toFixed(1);
-      capacityDisplay.textContent = tankData.tankVolume.toFixed(1);
-      levelDisplay.textContent = tankData.waterLevel.toFixed(1);
-      distanceDisplay.textContent = tankData.distance.toFixed(1);
-      
-      // Update alerts
-      if (tankData.alertsEnabled) {
-        // High level alert
-        if (tankData.percentage >= tankData.alertLevelHigh) {
-          highAlert.classList.add('active');
-        } else {
-          highAlert.classList.remove('active');
-        }
-        
-        // Low level alert
-        if (tankData.percentage <= tankData.alertLevelLow) {
-          lowAlert.classList.add('active');
-        } else {
-          lowAlert.classList.remove('active');
-        }
-      } else {
-        highAlert.classList.remove('active');
-        lowAlert.classList.remove('active');
-      }
-    }
-    
-    // Show notification
-    function showNotification(message, isError = false) {
-      notification.textContent = message;
-      
-      if (isError) {
-        notification.classList.add('error');
-      } else {
-        notification.classList.remove('error');
-      }
-      
-      notification.classList.add('show');
-      
-      setTimeout(function() {
-        notification.classList.remove('show');
-      }, 3000);
-    }
-    
-    // Calibration handlers
-    calibrateEmptyBtn.addEventListener('click', function() {
-      if (confirm('Calibrate empty tank? Make sure the tank is empty.')) {
-        fetch('/calibrate?type=empty')
-          .then(response => response.text())
-          .then(data => {
-            showNotification(data);
-            fetchTankData(); // Refresh data
-          })
-          .catch(error => {
-            showNotification('Calibration failed: ' + error, true);
-          });
-      }
-    });
-    
-    calibrateFullBtn.addEventListener('click', function() {
-      if (confirm('Calibrate full tank? Make sure the tank is filled to your desired "full" level.')) {
-        fetch('/calibrate?type=full')
-          .then(response => response.text())
-          .then(data => {
-            showNotification(data);
-            fetchTankData(); // Refresh data
-          })
-          .catch(error => {
-            showNotification('Calibration failed: ' + error, true);
-          });
-      }
-    });
-  </script>
-</body>
-</html>
-  )rawliteral";
-  
-  server.send(200, "text/html", html);
+void handleRoot(AsyncWebServerRequest* request) {
+  sendAsset(request, "/");
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #ifndef WEB_INTERFACE_H
 #define WEB_INTERFACE_H
 #include <ESPmDNS.h>
+#include <ESPAsyncWebServer.h>
 
 /**
  * Initialize the web server
@@ -9,54 +10,131 @@
 void setupWebServer();
 
 /**
- * Process web server requests
+ * Run deferred web server work (keep-alives, settings changes, scheduled restarts)
+ * Requests themselves are served by the async server
  * Should be called regularly in the main loop
  */
 void handleWebServer();
 
+/**
+ * Send a page or asset built into web_assets.h by its URL path
+ * Answers 304 when the request's If-None-Match matches the asset's ETag
+ */
+void sendAsset(AsyncWebServerRequest* request, const char* path);
+
+#define TEMPLATE_FIELD_SIZE 24  // Longest {{FIELD}} name + 1
+#define TEMPLATE_VALUE_SIZE 64  // Longest substituted value + 1
+
+/**
+ * Fill in one template field: write the value for name into value
+ * (at most size bytes including the terminator) and return its length
+ */
+typedef size_t (*TemplateResolver)(const char* name, char* value, size_t size);
+
+/**
+ * Stream a page template from flash as a chunked response
+ * {{FIELD}} placeholders are replaced by the resolver while streaming,
+ * so the page is never assembled in RAM
+ */
+void sendTemplate(AsyncWebServerRequest* request, const uint8_t* data, size_t length, TemplateResolver resolve);
+
 /**
  * Handle the root page
  */
-void handleRoot();
+void handleRoot(AsyncWebServerRequest* request);
 
 /**
  * Handle setting updates
  */
-void handleSet();
+void handleSet(AsyncWebServerRequest* request);
+
+/**
+ * Names of the settings accepted by /set, in the order they are applied
+ */
+extern const char* const SETTING_NAMES[];
+extern const size_t SETTING_COUNT;
+
+/**
+ * Apply one named setting after range checking it
+ * Only stores the value; returns true if it was accepted, after which the
+ * caller calls scheduleSettingsApply()
+ */
+bool applySetting(const String& name, const String& value);
+
+/**
+ * Store the current distance as the "empty" or "full" calibration point
+ * Returns false for an unknown calibration type
+ */
+bool applyCalibration(const String& type);
+
+/**
+ * Save the stored settings and apply them to the sensor filters and tank
+ * state from the main loop (handlers run on the async TCP task)
+ */
+void scheduleSettingsApply();
 
 /**
  * Handle tank data API endpoint
  */
-void handleTankData();
+void handleTankData(AsyncWebServerRequest* request);
+
+/**
+ * Build the real-time tank data JSON record into a buffer
+ * Returns the length, or 0 if the buffer was too small
+ */
+size_t buildTankDataJson(char* buffer, size_t size);
+
+/**
+ * Rebuild the cached tank data snapshot served by /tank-data and
+ * push it to event stream clients if it changed
+ * Call after each new water level calculation
+ */
+void publishTankData();
+
+/**
+ * Mark the cached tank data as outdated (e.g. after a settings change)
+ * The next /tank-data request rebuilds it
+ */
+void invalidateTankSnapshot();
+
+/**
+ * Handle history API endpoint (streams a time range of level history)
+ */
+void handleHistory(AsyncWebServerRequest* request);
+
+/**
+ * Handle metrics API endpoint (cache statistics and system health)
+ */
+void handleMetrics(AsyncWebServerRequest* request);
 
 /**
  * Handle settings API endpoint
  */
-void handleSettings();
+void handleSettings(AsyncWebServerRequest* request);
 
 /**
  * Handle settings page
  */
-void handleSettingsPage();
+void handleSettingsPage(AsyncWebServerRequest* request);
 
 /**
  * Handle calibration settings
  */
-void handleCalibrate();
+void handleCalibrate(AsyncWebServerRequest* request);
 
 /**
  * Handle network settings page
  */
-void handleNetworkSettings();
+void handleNetworkSettings(AsyncWebServerRequest* request);
 
 /**
  * Handle network scan API
  */
-void handleScanNetworks();
+void handleScanNetworks(AsyncWebServerRequest* request);
 
 /**
  * Handle WiFi reset
  */
-void handleResetWifi();
+void handleResetWifi(AsyncWebServerRequest* request);
 
 #endif // WEB_INTERFACE_H
\ No newline at end of file
@@ -1,61 +1,162 @@
 #include <WiFi.h>
 #include <ESPmDNS.h>
 #include <EEPROM.h>
+#include <time.h>
 #include "config.h"
+#include "config_journal.h"
+#include "config_store.h"
+#include "eeprom_manager.h"
 #include "wifi_manager.h"
 
 // Connection timeout constants
 #define WIFI_CONNECTION_TIMEOUT 30000  // 30 seconds
-#define WIFI_CHECK_INTERVAL 10000      // 10 seconds
-#define MAX_CONNECTION_ATTEMPTS 3
+#define MAX_CONNECTION_ATTEMPTS 3      // Failed attempts before the AP fallback comes up
+#define WIFI_FAST_CONNECT_TIMEOUT 5000 // 5 seconds for a directed connect to the cached AP
+#define WIFI_FAST_DHCP_TIMEOUT 10000   // The same when it still has to run DHCP
+#define WIFI_RETRY_BASE_DELAY 5000     // First reconnect backoff, doubled per failed attempt
+#define WIFI_RETRY_MAX_DELAY 300000    // Backoff cap (5 minutes), also the retry period in fallback
+#define WIFI_SCAN_TTL 30000            // Scan results older than this trigger a refresh
+#define WIFI_LEASE_MAX_AGE 3600        // Seconds a cached DHCP lease is reused, well inside common lease times
+#define WIFI_MIN_VALID_TIME 1600000000UL  // Earlier wall-clock times mean the clock was never set
 
 // Global instance
 WifiManager wifiManager;
 
+// Keys in wifiStore; WIFI_SCHEMA is written once the legacy EEPROM was migrated
+#define WIFI_SCHEMA_KEY "schema"
+#define WIFI_SCHEMA 1
+#define WIFI_CACHE_KEY "apCache"
+
+// Credentials, mode and static IP as the legacy journal kept them
+struct __attribute__((packed)) WifiConfigRecord {
+  char ssid[MAX_SSID_LENGTH];
+  char password[MAX_PASSWORD_LENGTH];
+  char deviceName[MAX_DEVICE_NAME_LENGTH];
+  uint8_t mode;
+  StaticIPConfig staticIP;
+};
+
+#define WIFI_CONFIG_MAGIC 0x46574C41  // "ALWF"
+
+static_assert(sizeof(WifiConfigRecord) <= EEPROM_WIFI_JOURNAL_SLOT_SIZE - CONFIG_JOURNAL_HEADER_SIZE,
+              "WiFi record does not fit a journal slot");
+static_assert(EEPROM_CACHE_JOURNAL_ADDR + EEPROM_CACHE_JOURNAL_SLOTS * EEPROM_CACHE_JOURNAL_SLOT_SIZE <= EEPROM_SIZE,
+              "Config journals do not fit EEPROM_SIZE");
+
+static ConfigJournal wifiJournal(EEPROM_WIFI_JOURNAL_ADDR, EEPROM_WIFI_JOURNAL_SLOTS,
+                                 EEPROM_WIFI_JOURNAL_SLOT_SIZE, WIFI_CONFIG_MAGIC);
+
+// Wall-clock seconds (the RTC keeps them across deep sleep), 0 until the clock was set
+static uint32_t leaseClock() {
+  time_t now = time(NULL);
+  return now >= (time_t)WIFI_MIN_VALID_TIME ? (uint32_t)now : 0;
+}
+
+// Raw block access for the legacy layout
+static void readEEPROMBlock(int address, void* data, size_t length) {
+  uint8_t* bytes = (uint8_t*)data;
+  for (size_t i = 0; i < length; i++) {
+    bytes[i] = EEPROM.read(address + i);
+  }
+}
+
+// Read the WiFi block stored in place at EEPROM_WIFI_START (before the journal)
+static bool loadLegacyWifiConfig(WifiConfigRecord& record) {
+  uint8_t mode = EEPROM.read(EEPROM_WIFI_MODE_ADDR);
+  uint8_t first = EEPROM.read(EEPROM_WIFI_SSID_ADDR);
+  if (mode > WIFI_MANAGER_MODE_FALLBACK || first == 0 || first == 0xFF) {
+    return false;
+  }
+
+  readEEPROMBlock(EEPROM_WIFI_SSID_ADDR, record.ssid, MAX_SSID_LENGTH);
+  readEEPROMBlock(EEPROM_WIFI_PASS_ADDR, record.password, MAX_PASSWORD_LENGTH);
+  readEEPROMBlock(EEPROM_DEVICE_NAME_ADDR, record.deviceName, MAX_DEVICE_NAME_LENGTH);
+  record.mode = mode;
+  if (EEPROM.read(EEPROM_STATIC_IP_ADDR) == EEPROM_INITIALIZED_MARKER) {
+    readEEPROMBlock(EEPROM_STATIC_IP_ADDR + 1, &record.staticIP, sizeof(record.staticIP));
+  }
+  return true;
+}
+
+// Newest legacy WiFi block: the journal, else the block at EEPROM_WIFI_START
+static bool loadLegacyWifiJournal(WifiConfigRecord& record) {
+  memset(&record, 0, sizeof(record));
+  record.mode = WIFI_MANAGER_MODE_AP;
+
+  if (wifiJournal.load(&record, sizeof(record)) > 0) {
+    return true;
+  }
+  return loadLegacyWifiConfig(record);
+}
+
+// One-time move of the WiFi settings from the emulated EEPROM to wifiStore
+// The legacy connection cache is left behind: it does not say when its lease
+// was obtained, so it could never be reused
+static void migrateWifiConfig() {
+  if (wifiStore.isKey(WIFI_SCHEMA_KEY)) {
+    // Settings were migrated before this, so the old blob can go
+    eraseLegacyEEPROM();
+    return;
+  }
+
+  WifiConfigRecord record;
+  bool found = false;
+  if (beginLegacyEEPROM()) {
+    found = loadLegacyWifiJournal(record);
+    endLegacyEEPROM();
+  }
+
+  bool ok = true;
+  if (found) {
+    Serial.println("[WiFi] Migrating WiFi settings from the legacy EEPROM layout");
+    record.ssid[MAX_SSID_LENGTH - 1] = '\0';
+    record.password[MAX_PASSWORD_LENGTH - 1] = '\0';
+    record.deviceName[MAX_DEVICE_NAME_LENGTH - 1] = '\0';
+    ok &= wifiStore.putString("ssid", record.ssid);
+    ok &= wifiStore.putString("password", record.password);
+    ok &= wifiStore.putString("deviceName", record.deviceName);
+    ok &= wifiStore.putInt("mode", record.mode);
+    ok &= wifiStore.putUInt("ip", record.staticIP.ip);
+    ok &= wifiStore.putUInt("gateway", record.staticIP.gateway);
+    ok &= wifiStore.putUInt("subnet", record.staticIP.subnet);
+    ok &= wifiStore.putUInt("dns", record.staticIP.dns);
+  }
+
+  // Written last, so an interrupted migration is redone on the next boot
+  if (!ok || !wifiStore.putUInt(WIFI_SCHEMA_KEY, WIFI_SCHEMA)) {
+    Serial.println("[WiFi ERROR] WiFi settings migration failed, retrying on the next boot");
+    return;
+  }
+  eraseLegacyEEPROM();
+}
+
 void WifiManager::begin() {
   Serial.println("[WiFi] Initializing WiFi manager...");
+  _scanMutex = xSemaphoreCreateMutex();
 
   // Always start with WiFi off
   WiFi.disconnect(true);
   WiFi.mode(WIFI_OFF);
   delay(100);
 
-  // Ensure EEPROM has been initialized with sufficient size
-  // Note: This is critical - we should not call EEPROM.begin() again if it was already
-  // initialized in setupEEPROM(), so this is just a safety check
-  if (!EEPROM.begin(EEPROM_SIZE)) {
-    Serial.println("[WiFi ERROR] Failed to initialize EEPROM!");
+  if (!wifiStore.begin()) {
+    Serial.println("[WiFi ERROR] Failed to open WiFi settings storage!");
     delay(1000);
   }
+  migrateWifiConfig();
 
-  char ssid[MAX_SSID_LENGTH] = {0};
-  char password[MAX_PASSWORD_LENGTH] = {0};
-  char deviceName[MAX_DEVICE_NAME_LENGTH] = {0};
-  Serial.println("[WiFi DEBUG] Checking if EEPROM is initialized...");
-  Serial.println("[WiFi DEBUG] EEPROM size: " + String(EEPROM_SIZE));
+  // Connection progress is reported by WiFi events and handled in process()
+  WiFi.onEvent([this](WiFiEvent_t event, WiFiEventInfo_t info) {
+    handleWifiEvent(event);
+  });
+  WiFi.setAutoReconnect(false);
 
   // Try to load saved credentials
-  if (loadWifiCredentials(ssid, password, deviceName) && strlen(ssid) > 0) {
-    Serial.println("[WiFi] Saved credentials found. Attempting to connect to WiFi...");
-    if (connectToWifi(ssid, password)) {
-      _currentMode = WIFI_MANAGER_MODE_STA;
-      
-      // Setup mDNS with device name
-      if (strlen(deviceName) > 0) {
-        String hostname = getSanitizedHostname(deviceName);
-        setupMDNS(hostname.c_str());
-      } else {
-        // Use default hostname with MAC address if no device name was set
-        char defaultName[32];
-        uint32_t chipId = ESP.getEfuseMac() & 0xFFFFFFFF;
-        sprintf(defaultName, "aqualevel-%08X", chipId);
-        setupMDNS(defaultName);
-      }
-    } else {
-      Serial.println("[WiFi] Failed to connect. Starting AP mode...");
-      startAPMode();
-      _currentMode = WIFI_MANAGER_MODE_FALLBACK;
-    }
+  if (loadWifiCredentials(_ssid, _password, _deviceName) && strlen(_ssid) > 0) {
+    Serial.println("[WiFi] Saved credentials found. Connecting in the background...");
+    _currentMode = WIFI_MANAGER_MODE_STA;
+    _connectionAttempts = 0;
+    connectToWifi(_ssid, _password);
   } else {
     Serial.println("[WiFi] No saved credentials. Starting AP mode...");
     startAPMode();
@@ -63,6 +164,21 @@ void WifiManager::begin() {
   }
 }
 
+// Runs in the WiFi event task: only record what happened
+void WifiManager::handleWifiEvent(WiFiEvent_t event) {
+  switch (event) {
+    case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+      _gotIPEvent = true;
+      break;
+    case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+    case ARDUINO_EVENT_WIFI_STA_LOST_IP:
+      _disconnectedEvent = true;
+      break;
+    default:
+      break;
+  }
+}
+
 bool WifiManager::startAPMode() {
   Serial.println("[WiFi] Starting Access Point mode...");
   
@@ -89,6 +205,9 @@ bool WifiManager::startAPMode() {
   Serial.print("[WiFi] AP IP Address: ");
   Serial.println(WiFi.softAPIP());
   
+  // Have the network list ready when the setup page opens
+  requestScan();
+  
   return true;
 }
 
@@ -101,27 +220,179 @@ bool WifiManager::connectToWifi(const char* ssid, const char* password) {
   Serial.print("[WiFi] Connecting to: ");
   Serial.println(ssid);
   
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(ssid, password);
+  _connectStartTime = millis();
+  _gotIPEvent = false;
+  _disconnectedEvent = false;
   
-  // Wait for connection with timeout
-  unsigned long startTime = millis();
-  while (WiFi.status() != WL_CONNECTED) {
-    delay(500);
-    Serial.print(".");
-    
-    if (millis() - startTime > WIFI_CONNECTION_TIMEOUT) {
-      Serial.println("\n[WiFi] Connection timeout!");
-      return false;
+  // Keep the fallback AP up while retrying from it
+  WiFi.mode(_currentMode == WIFI_MANAGER_MODE_FALLBACK ? WIFI_AP_STA : WIFI_STA);
+  
+  StaticIPConfig staticIP;
+  _useStaticIP = loadStaticIPConfig(staticIP);
+  if (_useStaticIP) {
+    WiFi.config(IPAddress(staticIP.ip), IPAddress(staticIP.gateway), IPAddress(staticIP.subnet), IPAddress(staticIP.dns));
+  } else if (_leaseReused) {
+    // The last attempt pinned the cached lease; zero addresses switch back to DHCP
+    WiFi.config(IPAddress((uint32_t)0), IPAddress((uint32_t)0), IPAddress((uint32_t)0));
+  }
+  _leaseReused = false;
+  
+  // Fast path: directed connect to the cached AP and channel instead of a full
+  // scan. While the last DHCP lease is surely still ours it is reused too, so
+  // DHCP is skipped; after that the router may have given the address away
+  WifiConnectionCache cache;
+  if (loadConnectionCache(cache)) {
+    uint32_t now = leaseClock();
+    _leaseReused = !_useStaticIP && now != 0 && cache.leaseTime != 0 &&
+                   now >= cache.leaseTime && now - cache.leaseTime < WIFI_LEASE_MAX_AGE;
+    Serial.println("[WiFi] Trying fast connect on channel " + String(cache.channel) +
+                   (_leaseReused ? ", reusing lease" : ""));
+    if (_leaseReused) {
+      WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway), IPAddress(cache.subnet), IPAddress(cache.dns));
     }
+    WiFi.begin(ssid, password, cache.channel, cache.bssid);
+    setConnectionState(WIFI_STATE_FAST_CONNECT);
+    return true;
   }
   
-  Serial.println();
+  // Normal path: scan, associate and DHCP
+  WiFi.begin(ssid, password);
+  setConnectionState(WIFI_STATE_CONNECTING);
+  return true;
+}
+
+void WifiManager::setConnectionState(WifiConnectionState state) {
+  _connectionState = state;
+  _stateStartTime = millis();
+}
+
+void WifiManager::onConnected() {
+  _lastConnectTime = millis() - _connectStartTime;
+  bool fastPath = (_connectionState == WIFI_STATE_FAST_CONNECT);
+  setConnectionState(WIFI_STATE_CONNECTED);
+  _connectionAttempts = 0;
+  
+  // Disconnect events from the attempt itself (an abandoned fast connect,
+  // association retries) arrive late and must not drop this connection
+  _disconnectedEvent = false;
+  
   Serial.print("[WiFi] Connected! IP address: ");
   Serial.println(WiFi.localIP());
+  Serial.println("[WiFi] Connect latency: " + String(_lastConnectTime) + " ms (" + (fastPath ? "fast" : "full") + ")");
   
-  _connectionAttempts = 0;
-  return true;
+  // Leaving the fallback AP once the network is back
+  if (_currentMode == WIFI_MANAGER_MODE_FALLBACK) {
+    Serial.println("[WiFi] Network is back, stopping fallback AP");
+    WiFi.mode(WIFI_STA);
+    _currentMode = WIFI_MANAGER_MODE_STA;
+  }
+  
+  // Remember this AP and lease for the next boot
+  saveConnectionCache();
+  
+  // Setup mDNS with device name
+  if (strlen(_deviceName) > 0) {
+    String hostname = getSanitizedHostname(_deviceName);
+    setupMDNS(hostname.c_str());
+  } else {
+    // Use default hostname with MAC address if no device name was set
+    char defaultName[32];
+    uint32_t chipId = ESP.getEfuseMac() & 0xFFFFFFFF;
+    sprintf(defaultName, "aqualevel-%08X", chipId);
+    setupMDNS(defaultName);
+  }
+}
+
+void WifiManager::onConnectFailed() {
+  _connectionAttempts++;
+  WiFi.disconnect();
+  
+  // Exponential backoff between attempts, capped
+  unsigned long backoff = WIFI_RETRY_BASE_DELAY;
+  for (int i = 1; i < _connectionAttempts && backoff < WIFI_RETRY_MAX_DELAY; i++) {
+    backoff *= 2;
+  }
+  _retryDelay = min(backoff, (unsigned long)WIFI_RETRY_MAX_DELAY);
+  
+  if (_connectionAttempts >= MAX_CONNECTION_ATTEMPTS && _currentMode == WIFI_MANAGER_MODE_STA) {
+    Serial.println("[WiFi] Max connection attempts reached. Switching to AP mode...");
+    startAPMode();
+    _currentMode = WIFI_MANAGER_MODE_FALLBACK;
+  }
+  
+  Serial.println("[WiFi] Connect attempt " + String(_connectionAttempts) + " failed, retrying in " +
+                 String(_retryDelay / 1000) + " s");
+  setConnectionState(WIFI_STATE_BACKOFF);
+}
+
+bool WifiManager::loadConnectionCache(WifiConnectionCache& cache) {
+  if (wifiStore.getBytes(WIFI_CACHE_KEY, &cache, sizeof(cache)) != sizeof(cache)) {
+    return false;
+  }
+  return cache.channel >= 1 && cache.channel <= 14;
+}
+
+void WifiManager::saveConnectionCache() {
+  WifiConnectionCache stored;
+  bool haveStored = loadConnectionCache(stored);
+  
+  WifiConnectionCache cache;
+  memset(&cache, 0, sizeof(cache));
+  memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+  cache.channel = WiFi.channel();
+  if (_leaseReused && haveStored) {
+    // The address is the cached lease pinned by connectToWifi(), not a new
+    // one, so it keeps the time of the DHCP exchange that granted it
+    cache.ip = stored.ip;
+    cache.gateway = stored.gateway;
+    cache.subnet = stored.subnet;
+    cache.dns = stored.dns;
+    cache.leaseTime = stored.leaseTime;
+  } else {
+    cache.ip = (uint32_t)WiFi.localIP();
+    cache.gateway = (uint32_t)WiFi.gatewayIP();
+    cache.subnet = (uint32_t)WiFi.subnetMask();
+    cache.dns = (uint32_t)WiFi.dnsIP();
+    // A static address is no lease, and one obtained before the clock was set has no known age
+    cache.leaseTime = _useStaticIP ? 0 : leaseClock();
+  }
+  
+  // Only touch flash when something actually changed
+  if (haveStored && memcmp(&stored, &cache, sizeof(cache)) == 0) {
+    return;
+  }
+  
+  wifiStore.putBytes(WIFI_CACHE_KEY, &cache, sizeof(cache));
+  Serial.println("[WiFi] Connection cache updated (channel " + String(cache.channel) + ")");
+}
+
+void WifiManager::clearConnectionCache() {
+  wifiStore.remove(WIFI_CACHE_KEY);
+}
+
+void WifiManager::saveStaticIPConfig(const StaticIPConfig& config) {
+  bool ok = wifiStore.putUInt("ip", config.ip);
+  ok &= wifiStore.putUInt("gateway", config.gateway);
+  ok &= wifiStore.putUInt("subnet", config.subnet);
+  ok &= wifiStore.putUInt("dns", config.dns);
+  
+  if (ok) {
+    Serial.println("[WiFi] Static IP configuration saved");
+  } else {
+    Serial.println("[WiFi ERROR] Failed to commit static IP configuration");
+  }
+}
+
+bool WifiManager::loadStaticIPConfig(StaticIPConfig& config) {
+  config.ip = wifiStore.getUInt("ip", 0);
+  config.gateway = wifiStore.getUInt("gateway", 0);
+  config.subnet = wifiStore.getUInt("subnet", 0);
+  config.dns = wifiStore.getUInt("dns", 0);
+  return config.ip != 0;
+}
+
+unsigned long WifiManager::getLastConnectTime() {
+  return _lastConnectTime;
 }
 
 bool WifiManager::setupMDNS(const char* hostname) {
@@ -155,77 +426,48 @@ bool WifiManager::setupMDNS(const char* hostname) {
 }
 
 void WifiManager::saveWifiCredentials(const char* ssid, const char* password, const char* deviceName) {
-  Serial.println("[WiFi] Saving WiFi credentials to EEPROM");
+  Serial.println("[WiFi] Saving WiFi credentials");
   Serial.println("[WiFi DEBUG] SSID to save: " + String(ssid));
   Serial.println("[WiFi DEBUG] SSID length: " + String(strlen(ssid)));
   
-  // Clear the credential area first
-  for (int i = EEPROM_WIFI_START; 
-       i < EEPROM_WIFI_START + MAX_SSID_LENGTH + MAX_PASSWORD_LENGTH + MAX_DEVICE_NAME_LENGTH + 1; 
-       i++) {
-    EEPROM.write(i, 0);
-  }
-  
-  // Write SSID (with length checking)
-  for (int i = 0; i < MAX_SSID_LENGTH && ssid[i] != '\0'; i++) {
-    EEPROM.write(EEPROM_WIFI_SSID_ADDR + i, ssid[i]);
-  }
-  
-  // Write password (with length checking)
-  for (int i = 0; i < MAX_PASSWORD_LENGTH && password[i] != '\0'; i++) {
-    EEPROM.write(EEPROM_WIFI_PASS_ADDR + i, password[i]);
-  }
-  
-  // Write device name (with length checking)
-  for (int i = 0; i < MAX_DEVICE_NAME_LENGTH && deviceName[i] != '\0'; i++) {
-    EEPROM.write(EEPROM_DEVICE_NAME_ADDR + i, deviceName[i]);
-  }
-  
-  // Write current mode
-  EEPROM.write(EEPROM_WIFI_MODE_ADDR, (uint8_t)_currentMode);
-  
-  // Commit changes to flash - CRITICAL for ESP32
-  if (EEPROM.commit()) {
-    Serial.println("[WiFi] WiFi credentials committed to EEPROM successfully");
+  // Truncated to the lengths the rest of the code works with
+  char value[MAX_PASSWORD_LENGTH];
+  strncpy(value, ssid, MAX_SSID_LENGTH - 1);
+  value[MAX_SSID_LENGTH - 1] = '\0';
+  bool ok = wifiStore.putString("ssid", value);
+  strncpy(value, password, MAX_PASSWORD_LENGTH - 1);
+  value[MAX_PASSWORD_LENGTH - 1] = '\0';
+  ok &= wifiStore.putString("password", value);
+  strncpy(value, deviceName, MAX_DEVICE_NAME_LENGTH - 1);
+  value[MAX_DEVICE_NAME_LENGTH - 1] = '\0';
+  ok &= wifiStore.putString("deviceName", value);
+  ok &= wifiStore.putInt("mode", _currentMode);
+  
+  if (ok) {
+    Serial.println("[WiFi] WiFi credentials committed successfully");
   } else {
-    Serial.println("[WiFi ERROR] Failed to commit WiFi credentials to EEPROM");
+    Serial.println("[WiFi ERROR] Failed to commit WiFi credentials");
   }
   
-  // Verify what was written
-  char verifySSID[MAX_SSID_LENGTH] = {0};
-  for (int i = 0; i < MAX_SSID_LENGTH && i < strlen(ssid); i++) {
-    verifySSID[i] = EEPROM.read(EEPROM_WIFI_SSID_ADDR + i);
-  }
-  Serial.println("[WiFi DEBUG] Verified SSID: " + String(verifySSID));
+  // The cached AP belongs to the old network
+  clearConnectionCache();
   
   Serial.println("[WiFi] WiFi credentials saved");
 }
 
 bool WifiManager::loadWifiCredentials(char* ssid, char* password, char* deviceName) {
-  Serial.println("[WiFi] Loading WiFi credentials from EEPROM");
+  Serial.println("[WiFi] Loading WiFi credentials");
   
-  // Read SSID
-  for (int i = 0; i < MAX_SSID_LENGTH; i++) {
-    ssid[i] = EEPROM.read(EEPROM_WIFI_SSID_ADDR + i);
-  }
-  ssid[MAX_SSID_LENGTH - 1] = '\0'; // Ensure null termination
+  // Strings come back null terminated and empty when missing
+  wifiStore.getString("ssid", ssid, MAX_SSID_LENGTH);
   Serial.println("[WiFi DEBUG] Loaded SSID: " + String(ssid));
   Serial.println("[WiFi DEBUG] Loaded SSID length: " + String(strlen(ssid)));
   
-  // Read password
-  for (int i = 0; i < MAX_PASSWORD_LENGTH; i++) {
-    password[i] = EEPROM.read(EEPROM_WIFI_PASS_ADDR + i);
-  }
-  password[MAX_PASSWORD_LENGTH - 1] = '\0'; // Ensure null termination
-  
-  // Read device name
-  for (int i = 0; i < MAX_DEVICE_NAME_LENGTH; i++) {
-    deviceName[i] = EEPROM.read(EEPROM_DEVICE_NAME_ADDR + i);
-  }
-  deviceName[MAX_DEVICE_NAME_LENGTH - 1] = '\0'; // Ensure null termination
+  wifiStore.getString("password", password, MAX_PASSWORD_LENGTH);
+  wifiStore.getString("deviceName", deviceName, MAX_DEVICE_NAME_LENGTH);
   
   // Read saved mode
-  uint8_t savedMode = EEPROM.read(EEPROM_WIFI_MODE_ADDR);
+  int32_t savedMode = wifiStore.getInt("mode", WIFI_MANAGER_MODE_AP);
   if (savedMode < WIFI_MANAGER_MODE_AP || savedMode > WIFI_MANAGER_MODE_FALLBACK) {
     // Invalid mode, default to AP
     savedMode = WIFI_MANAGER_MODE_AP;
@@ -239,18 +481,11 @@ bool WifiManager::loadWifiCredentials(char* ssid, char* password, char* deviceNa
 void WifiManager::resetWifiSettings() {
   Serial.println("[WiFi] Resetting WiFi settings");
   
-  // Clear the credential area
-  for (int i = EEPROM_WIFI_START; 
-       i < EEPROM_WIFI_START + MAX_SSID_LENGTH + MAX_PASSWORD_LENGTH + MAX_DEVICE_NAME_LENGTH + 1; 
-       i++) {
-    EEPROM.write(i, 0);
-  }
-  
-  // Set mode to AP
-  EEPROM.write(EEPROM_WIFI_MODE_ADDR, WIFI_MANAGER_MODE_AP);
-  
-  // Commit changes to flash
-  EEPROM.commit();
+  // Drops the credentials, static IP and cached AP; keeping the schema key
+  // stops the legacy EEPROM from being migrated again
+  wifiStore.clear();
+  wifiStore.putUInt(WIFI_SCHEMA_KEY, WIFI_SCHEMA);
+  wifiStore.putInt("mode", WIFI_MANAGER_MODE_AP);
   
   Serial.println("[WiFi] WiFi settings reset. Restarting...");
   
@@ -323,60 +558,113 @@ void WifiManager::process() {
   // Handle mDNS updates
   // ESP32's ESPmDNS library doesn't require explicit updates in the loop
   
-  // Check WiFi connection status periodically
-  if (_currentMode == WIFI_MANAGER_MODE_STA && (millis() - _lastWifiCheck > WIFI_CHECK_INTERVAL)) {
-    _lastWifiCheck = millis();
-    checkWifiConnection();
+  // Start a scan asked for by a web handler, then collect the results
+  if (_scanRequested) {
+    _scanRequested = false;
+    requestScan();
   }
-}
-
-void WifiManager::checkWifiConnection() {
-  if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("[WiFi] Connection lost, attempting to reconnect...");
-    
-    _connectionAttempts++;
-    
-    if (_connectionAttempts > MAX_CONNECTION_ATTEMPTS) {
-      Serial.println("[WiFi] Max connection attempts reached. Switching to AP mode...");
-      startAPMode();
-      _currentMode = WIFI_MANAGER_MODE_FALLBACK;
-      return;
-    }
-    
-    // Attempt to reconnect
-    char ssid[MAX_SSID_LENGTH] = {0};
-    char password[MAX_PASSWORD_LENGTH] = {0};
-    char deviceName[MAX_DEVICE_NAME_LENGTH] = {0};
-    
-    if (loadWifiCredentials(ssid, password, deviceName)) {
-      WiFi.disconnect();
-      delay(1000);
-      WiFi.begin(ssid, password);
+  processScan();
+  
+  // Advance the connection state machine; never blocks
+  switch (_connectionState) {
+    case WIFI_STATE_IDLE:
+      break;
       
-      // Quick check for reconnection
-      unsigned long startTime = millis();
-      while (WiFi.status() != WL_CONNECTED && (millis() - startTime < WIFI_CONNECTION_TIMEOUT)) {
-        delay(500);
-        Serial.print(".");
+    case WIFI_STATE_FAST_CONNECT:
+      if (_gotIPEvent) {
+        onConnected();
+      } else if (millis() - _stateStartTime >
+                 (_leaseReused || _useStaticIP ? WIFI_FAST_CONNECT_TIMEOUT : WIFI_FAST_DHCP_TIMEOUT)) {
+        Serial.println("[WiFi] Fast connect failed, falling back to full connect");
+        WiFi.disconnect();
+        clearConnectionCache();
+        if (_leaseReused) {
+          // Zero addresses switch back to DHCP
+          WiFi.config(IPAddress((uint32_t)0), IPAddress((uint32_t)0), IPAddress((uint32_t)0));
+          _leaseReused = false;
+        }
+        _disconnectedEvent = false;
+        WiFi.begin(_ssid, _password);
+        setConnectionState(WIFI_STATE_CONNECTING);
       }
+      break;
       
-      if (WiFi.status() == WL_CONNECTED) {
-        Serial.println("\n[WiFi] Reconnected successfully");
-        _connectionAttempts = 0;
-      } else {
-        Serial.println("\n[WiFi] Reconnect failed");
+    case WIFI_STATE_CONNECTING:
+      if (_gotIPEvent) {
+        onConnected();
+      } else if (millis() - _stateStartTime > WIFI_CONNECTION_TIMEOUT) {
+        Serial.println("[WiFi] Connection timeout!");
+        onConnectFailed();
       }
-    }
+      break;
+      
+    case WIFI_STATE_CONNECTED:
+      if (_disconnectedEvent) {
+        _disconnectedEvent = false;
+        
+        // Only a link that is really down counts; stale events are ignored
+        if (WiFi.status() == WL_CONNECTED) {
+          break;
+        }
+        Serial.println("[WiFi] Connection lost, reconnecting in the background...");
+        onConnectFailed();
+      }
+      break;
+      
+    case WIFI_STATE_BACKOFF:
+      if (millis() - _stateStartTime >= _retryDelay) {
+        connectToWifi(_ssid, _password);
+      }
+      break;
   }
 }
 
-std::vector<WiFiNetwork> WifiManager::scanNetworks() {
+WifiConnectionState WifiManager::getConnectionState() {
+  return _connectionState;
+}
+
+void WifiManager::requestScan() {
+  if (_scanInProgress) {
+    return;
+  }
+  
+  // A scan would hop channels under an association in progress; the next request retries
+  if (_connectionState == WIFI_STATE_FAST_CONNECT || _connectionState == WIFI_STATE_CONNECTING) {
+    return;
+  }
+  
   Serial.println("[WiFi] Scanning for networks...");
   
-  std::vector<WiFiNetwork> networks;
+  // Async scan, results are collected by process(); show hidden networks
+  int result = WiFi.scanNetworks(true, true);
+  if (result == WIFI_SCAN_FAILED) {
+    Serial.println("[WiFi] Failed to start network scan");
+    return;
+  }
+  _scanInProgress = true;
+}
+
+void WifiManager::scheduleScan() {
+  _scanRequested = true;
+}
+
+void WifiManager::processScan() {
+  if (!_scanInProgress) {
+    return;
+  }
   
-  // Start network scan (async=false is more reliable)
-  int networksFound = WiFi.scanNetworks(false, true); // Non-blocking, show hidden networks
+  int networksFound = WiFi.scanComplete();
+  if (networksFound == WIFI_SCAN_RUNNING) {
+    return;
+  }
+  _scanInProgress = false;
+  
+  if (networksFound == WIFI_SCAN_FAILED) {
+    Serial.println("[WiFi] Network scan failed");
+    return;
+  }
+  
+  std::vector<WiFiNetwork> networks;
   
   if (networksFound == 0) {
     Serial.println("[WiFi] No networks found");
@@ -418,8 +706,34 @@ std::vector<WiFiNetwork> WifiManager::scanNetworks() {
       });
   }
   
+  
   // Free memory used by scan
   WiFi.scanDelete();
   
+  xSemaphoreTake(_scanMutex, portMAX_DELAY);
+  _scanResults = networks;
+  _lastScanTime = millis();
+  xSemaphoreGive(_scanMutex);
+}
+
+std::vector<WiFiNetwork> WifiManager::getScanResults() {
+  xSemaphoreTake(_scanMutex, portMAX_DELAY);
+  std::vector<WiFiNetwork> networks = _scanResults;
+  xSemaphoreGive(_scanMutex);
   return networks;
+}
+
+long WifiManager::getScanAge() {
+  if (_lastScanTime == 0) {
+    return -1;
+  }
+  return (millis() - _lastScanTime) / 1000;
+}
+
+bool WifiManager::isScanStale() {
+  return _lastScanTime == 0 || millis() - _lastScanTime > WIFI_SCAN_TTL;
+}
+
+bool WifiManager::isScanning() {
+  return _scanInProgress || _scanRequested;
 }
\ No newline at end of file
@@ -2,6 +2,9 @@
 #define WIFI_MANAGER_H
 
 #include <Arduino.h>
+#include <WiFi.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 #include <vector>
 
 // Define constants here for use in other files
@@ -16,6 +19,15 @@ enum WifiManagerMode {
   WIFI_MANAGER_MODE_FALLBACK  // Fallback to AP mode when connection fails
 };
 
+// Station connection progress, advanced by process()
+enum WifiConnectionState {
+  WIFI_STATE_IDLE,          // Not connecting (AP mode)
+  WIFI_STATE_FAST_CONNECT,  // Directed connect to the cached AP
+  WIFI_STATE_CONNECTING,    // Full scan, associate and DHCP
+  WIFI_STATE_CONNECTED,     // Connected with an IP address
+  WIFI_STATE_BACKOFF        // Waiting before the next attempt
+};
+
 // Network information structure
 struct WiFiNetwork {
   String ssid;
@@ -23,6 +35,25 @@ struct WiFiNetwork {
   uint8_t encType;
 };
 
+// Association and DHCP lease from the last successful connection
+struct WifiConnectionCache {
+  uint8_t bssid[6];
+  uint8_t channel;
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+  uint32_t leaseTime;  // Wall-clock time the lease came from DHCP, 0 if unknown
+};
+
+// Optional static IP configuration
+struct StaticIPConfig {
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+};
+
 // Wi-Fi manager class
 class WifiManager {
 public:
@@ -32,7 +63,7 @@ public:
   // Setup Access Point mode
   bool startAPMode();
 
-  // Connect to Wi-Fi network in Station mode
+  // Start connecting to a Wi-Fi network in Station mode (non-blocking, see process())
   bool connectToWifi(const char* ssid, const char* password);
 
   // Setup mDNS with given hostname
@@ -47,6 +78,15 @@ public:
   // Reset Wi-Fi settings (clear EEPROM)
   void resetWifiSettings();
 
+  // Save static IP configuration to EEPROM (ip 0 selects DHCP)
+  void saveStaticIPConfig(const StaticIPConfig& config);
+
+  // Load static IP configuration from EEPROM; false if DHCP is used
+  bool loadStaticIPConfig(StaticIPConfig& config);
+
+  // Time taken by the last successful connection in milliseconds
+  unsigned long getLastConnectTime();
+
   // Check if device is connected to Wi-Fi
   bool isConnected();
 
@@ -59,20 +99,73 @@ public:
   // Get sanitized mDNS hostname (convert to lowercase, replace spaces with hyphens)
   String getSanitizedHostname(const char* deviceName);
 
-  // Process WiFi events and maintain connection
+  // Process WiFi events and maintain connection without blocking
   void process();
+
+  // Get the station connection progress
+  WifiConnectionState getConnectionState();
   
-  // Scan for available networks and return top results
-  std::vector<WiFiNetwork> scanNetworks();
+  // Start a background network scan (no-op while one is running)
+  // Main loop only; other tasks use scheduleScan()
+  void requestScan();
+
+  // Ask process() to start a scan (safe from the async web server task)
+  void scheduleScan();
+
+  // Copy of the networks from the last completed scan, strongest first
+  std::vector<WiFiNetwork> getScanResults();
+
+  // Seconds since the last completed scan, -1 if none yet
+  long getScanAge();
+
+  // True when there are no scan results or they are older than the TTL
+  bool isScanStale();
+
+  // True while a background scan is scheduled or running
+  bool isScanning();
 
 private:
   WifiManagerMode _currentMode = WIFI_MANAGER_MODE_AP;
-  unsigned long _lastWifiCheck = 0;
+  WifiConnectionState _connectionState = WIFI_STATE_IDLE;
   int _connectionAttempts = 0;
   bool _mDNSStarted = false;
-   
-  // Attempt Wi-Fi reconnection if disconnected
-  void checkWifiConnection();
+  bool _useStaticIP = false;
+  bool _leaseReused = false;  // Connecting with the cached lease instead of DHCP
+  unsigned long _stateStartTime = 0;
+  unsigned long _connectStartTime = 0;
+  unsigned long _retryDelay = 0;
+  unsigned long _lastConnectTime = 0;
+  char _ssid[MAX_SSID_LENGTH] = {0};
+  char _password[MAX_PASSWORD_LENGTH] = {0};
+  char _deviceName[MAX_DEVICE_NAME_LENGTH] = {0};
+
+  // Cached results of the last background scan, replaced by process() and
+  // read by web handlers, so only accessed under _scanMutex
+  std::vector<WiFiNetwork> _scanResults;
+  SemaphoreHandle_t _scanMutex = NULL;
+  volatile unsigned long _lastScanTime = 0;
+  volatile bool _scanInProgress = false;
+  volatile bool _scanRequested = false;
+
+  // Collect finished scan results
+  void processScan();
+
+  // Set by the WiFi event handler, consumed by process()
+  volatile bool _gotIPEvent = false;
+  volatile bool _disconnectedEvent = false;
+
+  // Record WiFi events (runs in the WiFi event task)
+  void handleWifiEvent(WiFiEvent_t event);
+
+  // State machine transitions
+  void setConnectionState(WifiConnectionState state);
+  void onConnected();
+  void onConnectFailed();
+
+  // Cached BSSID, channel and lease for fast reconnects
+  bool loadConnectionCache(WifiConnectionCache& cache);
+  void saveConnectionCache();
+  void clearConnectionCache();
 };
 
 // Global instance
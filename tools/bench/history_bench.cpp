@@ -0,0 +1,232 @@
+// history_bench.cpp
+// Host benchmark: HistoryStore fed with a recorded or synthetic tank trace
+//
+// Reports for each tier the points held, encoded bytes per point and the time
+// span the default capacities cover, then the encode throughput (samples
+// through HistoryStore::add, bucketing included) and the decode throughput
+// (all tiers read back in batches of 16 points, as handleHistory does).
+// The points read back are checked against min/avg/max buckets computed
+// directly from the trace, so a codec bug fails the run.
+// Traces are CSV lines "time_s,level_percent"; lines starting with # are
+// skipped. tools/bench/make_tank_trace.py writes them, and
+// tools/bench/traces/tank_day.csv is one day made with its defaults.
+// Timings are host nanoseconds, only meaningful relative to each other.
+//
+// Build and run from the repository root:
+//   g++ -O2 -std=c++17 -I AquaLevel tools/bench/history_bench.cpp AquaLevel/history_store.cpp AquaLevel/history_codec.cpp -o /tmp/history_bench
+//   /tmp/history_bench tools/bench/traces/tank_day.csv
+//   python3 tools/bench/make_tank_trace.py --days 365 | /tmp/history_bench -
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "history_store.h"
+
+struct Sample {
+  uint32_t time;
+  float value;
+};
+
+// Bucket computed straight from the trace, in the store's 0.01 % steps
+struct Expected {
+  uint32_t time;
+  uint16_t min;
+  uint16_t avg;
+  uint16_t max;
+};
+
+// The store holds about 48 KB; keep it off the stack
+static HistoryStore store;
+
+static const char* TIER_NAMES[HISTORY_TIER_COUNT] = {"raw", "5 min", "1 h"};
+
+static bool loadTrace(const char* path, std::vector<Sample>& samples) {
+  FILE* file = strcmp(path, "-") == 0 ? stdin : fopen(path, "r");
+  if (!file) {
+    return false;
+  }
+
+  char line[128];
+  while (fgets(line, sizeof(line), file)) {
+    if (line[0] == '#' || line[0] == '\n') {
+      continue;
+    }
+    unsigned long time;
+    float value;
+    if (sscanf(line, "%lu,%f", &time, &value) == 2) {
+      samples.push_back({(uint32_t)time, value});
+    }
+  }
+
+  if (file != stdin) {
+    fclose(file);
+  }
+  return true;
+}
+
+// Same rounding as the store
+static uint16_t quantize(float value) {
+  if (!(value > 0)) return 0;
+  if (value >= 100.0f) return 10000;
+  return (uint16_t)(value * 100.0f + 0.5f);
+}
+
+// Reference min/avg/max buckets; hour buckets merge the 5 minute sums, like the store
+static void bucketize(const std::vector<Sample>& samples, std::vector<Expected>& minutes, std::vector<Expected>& hours) {
+  struct Acc { uint32_t time; uint16_t min, max; uint32_t sum, count; };
+  Acc minute = {0, 0, 0, 0, 0};
+  Acc hour = {0, 0, 0, 0, 0};
+
+  auto close = [](const Acc& acc, std::vector<Expected>& out) {
+    out.push_back({acc.time, acc.min, (uint16_t)((acc.sum + acc.count / 2) / acc.count), acc.max});
+  };
+  auto merge = [](Acc& acc, uint32_t time, uint16_t min, uint16_t max, uint32_t sum, uint32_t count) {
+    if (acc.count == 0) {
+      acc = {time, min, max, 0, 0};
+    }
+    if (min < acc.min) acc.min = min;
+    if (max > acc.max) acc.max = max;
+    acc.sum += sum;
+    acc.count += count;
+  };
+
+  for (const Sample& s : samples) {
+    uint16_t q = quantize(s.value);
+    uint32_t bucket = s.time - s.time % HISTORY_MINUTE_BUCKET;
+    if (minute.count > 0 && minute.time != bucket) {
+      close(minute, minutes);
+      uint32_t hourBucket = minute.time - minute.time % HISTORY_HOUR_BUCKET;
+      if (hour.count > 0 && hour.time != hourBucket) {
+        close(hour, hours);
+        hour.count = 0;
+      }
+      merge(hour, hourBucket, minute.min, minute.max, minute.sum, minute.count);
+      minute.count = 0;
+    }
+    merge(minute, bucket, q, q, q, 1);
+  }
+
+  // Queries also return the open buckets; the open 5 minute bucket is not
+  // merged into the hour tier until it closes
+  if (minute.count > 0) {
+    close(minute, minutes);
+  }
+  if (hour.count > 0) {
+    close(hour, hours);
+  }
+}
+
+static void fill(const std::vector<Sample>& samples) {
+  store.clear();
+  for (const Sample& s : samples) {
+    store.add(s.time, s.value);
+  }
+}
+
+// Read a whole tier in batches of 16 points
+static size_t readTier(uint8_t tier, std::vector<HistoryPoint>* out) {
+  HistoryPoint batch[16];
+  uint32_t from = 0;
+  size_t total = 0;
+  size_t n;
+  while ((n = store.read(tier, from, UINT32_MAX, batch, 16)) > 0) {
+    if (out) {
+      out->insert(out->end(), batch, batch + n);
+    }
+    total += n;
+    from = batch[n - 1].time + 1;
+  }
+  return total;
+}
+
+// Compare a tier read back from the store with the newest reference points
+static size_t verifyTier(uint8_t tier, const std::vector<Expected>& expected) {
+  std::vector<HistoryPoint> points;
+  readTier(tier, &points);
+  if (points.size() > expected.size()) {
+    return points.size();
+  }
+
+  size_t errors = 0;
+  size_t offset = expected.size() - points.size();
+  for (size_t i = 0; i < points.size(); i++) {
+    const Expected& e = expected[offset + i];
+    const HistoryPoint& p = points[i];
+    if (p.time != e.time || quantize(p.min) != e.min || quantize(p.avg) != e.avg || quantize(p.max) != e.max) {
+      if (errors++ == 0) {
+        printf("%s mismatch at %u: got %.2f/%.2f/%.2f, expected %.2f/%.2f/%.2f\n", TIER_NAMES[tier], e.time,
+               p.min, p.avg, p.max, e.min / 100.0, e.avg / 100.0, e.max / 100.0);
+      }
+    }
+  }
+  return errors;
+}
+
+int main(int argc, char** argv) {
+  const char* path = argc > 1 ? argv[1] : "tools/bench/traces/tank_day.csv";
+  std::vector<Sample> samples;
+  if (!loadTrace(path, samples) || samples.empty()) {
+    fprintf(stderr, "no samples in %s\n", path);
+    return 1;
+  }
+
+  // Raw samples carry one value; the references are min == avg == max
+  std::vector<Expected> raw, minutes, hours;
+  for (const Sample& s : samples) {
+    uint16_t q = quantize(s.value);
+    raw.push_back({s.time, q, q, q});
+  }
+  bucketize(samples, minutes, hours);
+
+  fill(samples);
+  size_t errors = verifyTier(HISTORY_TIER_RAW, raw) + verifyTier(HISTORY_TIER_MINUTE, minutes) +
+                  verifyTier(HISTORY_TIER_HOUR, hours);
+
+  double days = (samples.back().time - samples.front().time) / 86400.0;
+  printf("%s: %zu samples over %.1f days, store %zu bytes\n", path, samples.size(), days, sizeof(store));
+  printf("%-6s %10s %10s %10s %10s\n", "tier", "points", "bytes", "B/point", "span (h)");
+  for (uint8_t tier = 0; tier < HISTORY_TIER_COUNT; tier++) {
+    // count() leaves out the open bucket that queries add
+    size_t points = store.count(tier);
+    size_t bytes = store.encodedBytes(tier);
+    HistoryPoint first;
+    double span = 0;
+    if (points > 0 && store.read(tier, 0, UINT32_MAX, &first, 1) == 1) {
+      uint32_t last = tier == HISTORY_TIER_RAW ? samples.back().time
+                                               : (tier == HISTORY_TIER_MINUTE ? minutes : hours).back().time;
+      span = (last - first.time) / 3600.0;
+    }
+    printf("%-6s %10zu %10zu %10.2f %10.1f\n", TIER_NAMES[tier], points, bytes,
+           points > 0 ? (double)bytes / points : 0.0, span);
+  }
+
+  // Repeat until each measurement runs for about half a second
+  using Clock = std::chrono::steady_clock;
+  size_t rounds = 0;
+  auto start = Clock::now();
+  do {
+    fill(samples);
+    rounds++;
+  } while (Clock::now() - start < std::chrono::milliseconds(500));
+  double encodeNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+  double encodeRate = rounds * samples.size() / (encodeNs / 1e9);
+
+  size_t decoded = 0;
+  rounds = 0;
+  start = Clock::now();
+  do {
+    for (uint8_t tier = 0; tier < HISTORY_TIER_COUNT; tier++) {
+      decoded += readTier(tier, nullptr);
+    }
+    rounds++;
+  } while (Clock::now() - start < std::chrono::milliseconds(500));
+  double decodeNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+  double decodeRate = decoded / (decodeNs / 1e9);
+
+  printf("encode %.1f M samples/s (%.0f ns/sample), decode %.1f M points/s (%.0f ns/point)\n",
+         encodeRate / 1e6, 1e9 / encodeRate, decodeRate / 1e6, 1e9 / decodeRate);
+  printf("round trip: %s\n", errors == 0 ? "ok" : "MISMATCH");
+  return errors == 0 ? 0 : 1;
+}
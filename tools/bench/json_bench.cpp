@@ -0,0 +1,302 @@
+// json_bench.cpp
+// Host micro-benchmark: the /tank-data record built with String += (as
+// handleTankData did before JsonWriter) against JsonWriter into a fixed buffer
+//
+// Arduino's String is not available on the host, so BenchString below follows
+// the allocation policy of the ESP32 core's WString: strings of up to 10
+// characters live inline (SSO), longer ones are (re)allocated rounded up to
+// 16 bytes whenever a concatenation outgrows the buffer. The String version
+// of the record is a line-for-line copy of the old buildTankDataJson().
+// Timings are host nanoseconds, only meaningful relative to each other;
+// allocation counts carry over to the device.
+//
+// Build and run from the repository root:
+//   g++ -O2 -std=c++17 -I AquaLevel tools/bench/json_bench.cpp AquaLevel/json_writer.cpp -o /tmp/json_bench
+//   /tmp/json_bench [iterations]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include "json_writer.h"
+
+// Heap operations seen by either version; a realloc that grows a string
+// counts as an allocation
+static size_t heapAllocs = 0;
+static size_t heapFrees = 0;
+static size_t heapBytes = 0;
+
+void* operator new(size_t size) {
+  heapAllocs++;
+  heapBytes += size;
+  void* p = malloc(size);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) noexcept {
+  if (p) heapFrees++;
+  free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  operator delete(p);
+}
+
+// Allocation model of the ESP32 core's String
+class BenchString {
+public:
+  BenchString() { init(); }
+  BenchString(const char* text) { init(); copy(text, strlen(text)); }
+  BenchString(const BenchString& other) { init(); copy(other.c_str(), other._len); }
+  BenchString(BenchString&& other) {
+    // Takes over the heap buffer, like String's move constructor
+    memcpy(this, &other, sizeof(*this));
+    other.init();
+  }
+  BenchString(float value, unsigned int decimals) {
+    char buf[33];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, value);
+    init();
+    copy(buf, strlen(buf));
+  }
+  BenchString(unsigned long value) {
+    char buf[21];
+    snprintf(buf, sizeof(buf), "%lu", value);
+    init();
+    copy(buf, strlen(buf));
+  }
+  BenchString(int value) {
+    char buf[12];
+    snprintf(buf, sizeof(buf), "%d", value);
+    init();
+    copy(buf, strlen(buf));
+  }
+  ~BenchString() {
+    if (!_sso) {
+      heapFrees++;
+      free(_heap);
+    }
+  }
+
+  BenchString& operator+=(const BenchString& other) { concat(other.c_str(), other._len); return *this; }
+  BenchString& operator+=(const char* text) { concat(text, strlen(text)); return *this; }
+
+  const char* c_str() const { return _sso ? _inline : _heap; }
+  size_t length() const { return _len; }
+
+  void concat(const char* text, size_t length) {
+    reserve(_len + length);
+    memcpy(buffer() + _len, text, length);
+    _len += length;
+    buffer()[_len] = '\0';
+  }
+
+private:
+  static const size_t SSO_SIZE = 11;  // Inline capacity including the terminator
+
+  bool _sso;
+  size_t _len;
+  size_t _capacity;
+  char* _heap;
+  char _inline[SSO_SIZE];
+
+  void init() {
+    _sso = true;
+    _len = 0;
+    _capacity = SSO_SIZE - 1;
+    _heap = nullptr;
+    _inline[0] = '\0';
+  }
+
+  char* buffer() { return _sso ? _inline : _heap; }
+
+  void reserve(size_t length) {
+    if (length <= _capacity) {
+      return;
+    }
+    size_t size = (length + 16) & ~(size_t)0xF;
+    char* grown = (char*)realloc(_sso ? nullptr : _heap, size);
+    heapAllocs++;
+    heapBytes += size;
+    if (_sso) {
+      memcpy(grown, _inline, _len + 1);
+      _sso = false;
+    }
+    _heap = grown;
+    _capacity = size - 1;
+  }
+
+  void copy(const char* text, size_t length) {
+    _len = 0;
+    concat(text, length);
+  }
+};
+
+// "literal" + String(...) + "," appends to one temporary, like StringSumHelper
+static BenchString operator+(BenchString lhs, const BenchString& rhs) {
+  lhs += rhs;
+  return lhs;
+}
+
+static BenchString operator+(BenchString lhs, const char* rhs) {
+  lhs += rhs;
+  return lhs;
+}
+
+// Readings that go into the record; varied per iteration
+struct TankState {
+  float currentDistance, trackedDistance, currentFillRate, currentAirTemperature, currentLevelRate;
+  unsigned long sampleInterval, awakeTime, wakeCount;
+  bool lowPowerMode;
+  float currentWaterLevel, currentPercentage, currentVolume, tankHeight, tankDiameter, tankVolume;
+  int alertLevelLow, alertLevelHigh;
+  bool lowAlertActive, highAlertActive, alertsEnabled;
+};
+
+static BenchString buildWithString(const TankState& s) {
+  BenchString json = "{";
+  json += "\"distance\":" + BenchString(s.currentDistance, 1) + ",";
+  json += "\"trackedDistance\":" + BenchString(s.trackedDistance, 1) + ",";
+  json += "\"fillRate\":" + BenchString(s.currentFillRate, 2) + ",";
+  json += "\"airTemperature\":" + BenchString(s.currentAirTemperature, 1) + ",";
+  json += "\"levelRate\":" + BenchString(s.currentLevelRate, 2) + ",";
+  json += "\"sampleInterval\":" + BenchString(s.sampleInterval) + ",";
+  json += "\"lowPowerMode\":" + BenchString(s.lowPowerMode ? "true" : "false") + ",";
+  json += "\"awakeTime\":" + BenchString(s.awakeTime) + ",";
+  json += "\"wakeCount\":" + BenchString(s.wakeCount) + ",";
+  json += "\"waterLevel\":" + BenchString(s.currentWaterLevel, 1) + ",";
+  json += "\"percentage\":" + BenchString(s.currentPercentage, 1) + ",";
+  json += "\"volume\":" + BenchString(s.currentVolume, 1) + ",";
+  json += "\"tankHeight\":" + BenchString(s.tankHeight, 1) + ",";
+  json += "\"tankDiameter\":" + BenchString(s.tankDiameter, 1) + ",";
+  json += "\"tankVolume\":" + BenchString(s.tankVolume, 1) + ",";
+  json += "\"alertLevelLow\":" + BenchString(s.alertLevelLow) + ",";
+  json += "\"alertLevelHigh\":" + BenchString(s.alertLevelHigh) + ",";
+  json += "\"lowAlertActive\":" + BenchString(s.lowAlertActive ? "true" : "false") + ",";
+  json += "\"highAlertActive\":" + BenchString(s.highAlertActive ? "true" : "false") + ",";
+  json += "\"alertsEnabled\":" + BenchString(s.alertsEnabled ? "true" : "false");
+  json += "}";
+  return json;
+}
+
+// Same fields as buildTankDataJson() in web_interface.cpp
+static size_t buildWithWriter(const TankState& s, char* buffer, size_t size) {
+  JsonWriter json(buffer, size);
+  json.beginObject();
+  json.add("distance", s.currentDistance, 1);
+  json.add("trackedDistance", s.trackedDistance, 1);
+  json.add("fillRate", s.currentFillRate, 2);
+  json.add("airTemperature", s.currentAirTemperature, 1);
+  json.add("levelRate", s.currentLevelRate, 2);
+  json.add("sampleInterval", s.sampleInterval);
+  json.add("lowPowerMode", s.lowPowerMode);
+  json.add("awakeTime", s.awakeTime);
+  json.add("wakeCount", s.wakeCount);
+  json.add("waterLevel", s.currentWaterLevel, 1);
+  json.add("percentage", s.currentPercentage, 1);
+  json.add("volume", s.currentVolume, 1);
+  json.add("tankHeight", s.tankHeight, 1);
+  json.add("tankDiameter", s.tankDiameter, 1);
+  json.add("tankVolume", s.tankVolume, 1);
+  json.add("alertLevelLow", s.alertLevelLow);
+  json.add("alertLevelHigh", s.alertLevelHigh);
+  json.add("lowAlertActive", s.lowAlertActive);
+  json.add("highAlertActive", s.highAlertActive);
+  json.add("alertsEnabled", s.alertsEnabled);
+  json.endObject();
+  return json.overflowed() ? 0 : json.length();
+}
+
+static TankState stateFor(unsigned int i) {
+  // Kept off exact .x5/.xx5 ties, which printf rounds to even and JsonWriter
+  // (like String) rounds up
+  float level = (i % 6400) / 64.0f + 1.0f / 1024;
+  TankState s;
+  s.currentDistance = 95.0f - level * 0.9f;
+  s.trackedDistance = s.currentDistance + 0.125f;
+  s.currentFillRate = (int)(i % 512) / 64.0f - 4.0f + 1.0f / 1024;
+  s.currentAirTemperature = 21.5f;
+  s.currentLevelRate = s.currentFillRate / 2.0f;
+  s.sampleInterval = 5000;
+  s.awakeTime = 180 + i % 40;
+  s.wakeCount = i;
+  s.lowPowerMode = false;
+  s.currentWaterLevel = level * 0.9f;
+  s.currentPercentage = level;
+  s.currentVolume = level * 2.0f;
+  s.tankHeight = 100.0f;
+  s.tankDiameter = 50.0f;
+  s.tankVolume = 200.0f;
+  s.alertLevelLow = 10;
+  s.alertLevelHigh = 90;
+  s.lowAlertActive = level < 10;
+  s.highAlertActive = level > 90;
+  s.alertsEnabled = true;
+  return s;
+}
+
+struct Result {
+  double nsPerResponse;
+  double allocsPerResponse;
+  double freesPerResponse;
+  double bytesPerResponse;
+  size_t length;
+};
+
+int main(int argc, char** argv) {
+  unsigned int iterations = argc > 1 ? (unsigned int)atoi(argv[1]) : 200000;
+  char buffer[1024];
+  size_t checksum = 0;
+
+  // Both versions must produce the same record
+  unsigned int mismatches = 0;
+  for (unsigned int i = 0; i < 6400; i++) {
+    TankState s = stateFor(i * 7);
+    BenchString text = buildWithString(s);
+    size_t length = buildWithWriter(s, buffer, sizeof(buffer));
+    if (length != text.length() || memcmp(buffer, text.c_str(), length) != 0) {
+      if (mismatches++ == 0) {
+        printf("mismatch:\n  %s\n  %s\n", text.c_str(), buffer);
+      }
+    }
+  }
+
+  Result results[2];
+  for (int version = 0; version < 2; version++) {
+    heapAllocs = heapFrees = heapBytes = 0;
+    size_t length = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; i++) {
+      TankState s = stateFor(i);
+      if (version == 0) {
+        BenchString text = buildWithString(s);
+        length = text.length();
+        checksum += text.c_str()[length / 2];
+      } else {
+        length = buildWithWriter(s, buffer, sizeof(buffer));
+        checksum += buffer[length / 2];
+      }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    results[version].nsPerResponse = (double)elapsed.count() / iterations;
+    results[version].allocsPerResponse = (double)heapAllocs / iterations;
+    results[version].freesPerResponse = (double)heapFrees / iterations;
+    results[version].bytesPerResponse = (double)heapBytes / iterations;
+    results[version].length = length;
+  }
+
+  printf("/tank-data record, %u iterations (checksum %zu)\n", iterations, checksum);
+  printf("%-12s %10s %12s %12s %12s %8s\n", "version", "ns/resp", "allocs/resp", "frees/resp", "heap B/resp", "length");
+  const char* names[2] = {"String +=", "JsonWriter"};
+  for (int version = 0; version < 2; version++) {
+    printf("%-12s %10.0f %12.1f %12.1f %12.0f %8zu\n", names[version], results[version].nsPerResponse,
+           results[version].allocsPerResponse, results[version].freesPerResponse,
+           results[version].bytesPerResponse, results[version].length);
+  }
+  printf("identical output: %s\n", mismatches == 0 ? "yes" : "NO");
+  return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""
+Generate a synthetic tank level trace for tools/bench/history_bench.cpp
+
+The trace mimics what recordHistory() sees on a domestic tank: one sample
+every measurement interval (5 s by default, drifting slightly so the
+second-resolution timestamps occasionally step by one more second), a level
+that drains with the household's daily usage pattern and is refilled by a
+pump below a threshold, and ultrasonic noise passed through the same
+moving average the firmware applies (readingSmoothing).
+
+Output is CSV: time in seconds, level in percent with two decimals (the
+history store keeps 0.01 % steps). The same seed always gives the same
+trace. tools/bench/traces/tank_day.csv was made with the defaults:
+    python3 tools/bench/make_tank_trace.py > tools/bench/traces/tank_day.csv
+
+A year, piped straight into the benchmark:
+    python3 tools/bench/make_tank_trace.py --days 365 | /tmp/history_bench -
+"""
+
+import argparse
+import random
+import sys
+
+# Household usage in % of the tank per hour, by hour of day
+USAGE = [0.5] * 6 + [6.0, 7.0, 5.0] + [2.0] * 9 + [5.0, 6.0, 4.0, 3.0] + [1.0, 0.5]
+
+PUMP_START = 25.0   # Pump switches on below this level
+PUMP_STOP = 95.0    # and off above this one
+PUMP_RATE = 60.0    # % per hour while pumping
+
+
+def generate(days, interval, drift, noise, smoothing, seed, out):
+    rng = random.Random(seed)
+    level = 80.0
+    pumping = False
+    readings = []
+    clock = 0.0
+    end = days * 86400.0
+    day_factor = 1.0
+    last_day = -1
+
+    out.write("# synthetic tank trace: %d days, %.2f s interval, noise %.2f %%, smoothing %d, seed %d\n"
+              % (days, interval, noise, smoothing, seed))
+    out.write("# time_s,level_percent\n")
+
+    while clock < end:
+        day = int(clock // 86400)
+        if day != last_day:
+            # Some days use more water than others
+            day_factor = rng.uniform(0.8, 1.2)
+            last_day = day
+
+        hours = interval / 3600.0
+        hour = int(clock % 86400 // 3600)
+        level -= USAGE[hour] * day_factor * rng.uniform(0.5, 1.5) * hours
+        if level < PUMP_START:
+            pumping = True
+        if pumping:
+            level += PUMP_RATE * hours
+            if level >= PUMP_STOP:
+                pumping = False
+        level = max(0.0, min(100.0, level))
+
+        # Sensor noise, then the firmware's moving average
+        readings.append(level + rng.gauss(0.0, noise))
+        if len(readings) > smoothing:
+            readings.pop(0)
+        measured = max(0.0, min(100.0, sum(readings) / len(readings)))
+
+        out.write("%d,%.2f\n" % (int(clock), measured))
+        clock += interval * (1.0 + drift)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Synthetic tank level trace")
+    parser.add_argument("--days", type=int, default=1)
+    parser.add_argument("--interval", type=float, default=5.0, help="seconds between samples (default 5)")
+    parser.add_argument("--drift", type=float, default=0.004,
+                        help="relative slip of the sampling period (default 0.004)")
+    parser.add_argument("--noise", type=float, default=0.3, help="sensor noise, 1 sigma in %% (default 0.3)")
+    parser.add_argument("--smoothing", type=int, default=5, help="moving average length (default 5)")
+    parser.add_argument("--seed", type=int, default=1)
+    args = parser.parse_args()
+
+    generate(args.days, args.interval, args.drift, args.noise, args.smoothing, args.seed, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""
+Build the web UI assets into AquaLevel/web_assets.h
+
+Each page in web/ has its inline <style> and <script> moved into separate
+assets named after their content hash, so browsers can cache them forever.
+Everything is minified, gzipped and written out as PROGMEM byte arrays with
+an ETag, served by web_interface.cpp with Content-Encoding: gzip.
+
+Templated pages keep their HTML uncompressed with {{FIELD}} placeholders,
+which web_interface.cpp fills in while streaming the page from flash.
+
+Run after editing anything in web/:
+    python3 tools/build_web_assets.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB_DIR = os.path.join(ROOT, "web")
+OUTPUT = os.path.join(ROOT, "AquaLevel", "web_assets.h")
+
+# Page file, URL it is served at, C identifier prefix, templated
+PAGES = [
+    ("index.html", "/", "INDEX", False),
+    ("settings.html", "/settings.html", "SETTINGS", False),
+    ("network.html", "/network", "NETWORK", True),
+]
+
+# HTML is revalidated on every load (answered with 304 while unchanged);
+# hashed assets never change under the same URL
+HTML_CACHE_CONTROL = "no-cache"
+ASSET_CACHE_CONTROL = "public, max-age=31536000, immutable"
+
+
+def minify_css(css):
+    css = re.sub(r"/\*.*?\*/", "", css, flags=re.S)
+    lines = [line.strip() for line in css.splitlines()]
+    css = "".join(line for line in lines if line)
+    return re.sub(r"\s*([{}:;,>])\s*", r"\1", css)
+
+
+def minify_js(js):
+    # Line based so automatic semicolon insertion is unaffected
+    lines = [line.strip() for line in js.splitlines()]
+    return "\n".join(line for line in lines if line and not line.startswith("//"))
+
+
+def minify_html(html):
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    lines = [line.strip() for line in html.splitlines()]
+    return "\n".join(line for line in lines if line)
+
+
+def content_hash(data):
+    return hashlib.sha256(data).hexdigest()[:16]
+
+
+def compress(data):
+    # Fixed mtime keeps the output (and the ETag) reproducible
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def c_array(name, data):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]))
+    return "static const uint8_t %s[] PROGMEM = {\n%s\n};\n" % (name, ",\n".join(rows))
+
+
+def build():
+    assets = []     # (path, content type, identifier, raw bytes, cache control)
+    templates = []  # (path, identifier, raw bytes)
+
+    for filename, path, ident, templated in PAGES:
+        with open(os.path.join(WEB_DIR, filename), encoding="utf-8") as f:
+            html = f.read()
+
+        style = re.search(r"<style>(.*?)</style>", html, flags=re.S)
+        if style:
+            css = minify_css(style.group(1)).encode("utf-8")
+            css_path = "/assets/%s.%s.css" % (ident.lower(), content_hash(css))
+            html = html[:style.start()] + '<link rel="stylesheet" href="%s">' % css_path + html[style.end():]
+            assets.append((css_path, "text/css", ident + "_CSS", css, ASSET_CACHE_CONTROL))
+
+        script = re.search(r"<script>(.*?)</script>", html, flags=re.S)
+        if script:
+            js = minify_js(script.group(1)).encode("utf-8")
+            js_path = "/assets/%s.%s.js" % (ident.lower(), content_hash(js))
+            html = html[:script.start()] + '<script src="%s"></script>' % js_path + html[script.end():]
+            assets.append((js_path, "application/javascript", ident + "_JS", js, ASSET_CACHE_CONTROL))
+
+        page = minify_html(html).encode("utf-8")
+        if templated:
+            templates.append((path, ident, page))
+        else:
+            assets.append((path, "text/html", ident + "_HTML", page, HTML_CACHE_CONTROL))
+
+    out = []
+    out.append("// web_assets.h\n")
+    out.append("// Generated by tools/build_web_assets.py from web/ - do not edit\n")
+    out.append("#ifndef WEB_ASSETS_H\n#define WEB_ASSETS_H\n\n#include <Arduino.h>\n\n")
+    out.append("struct WebAsset {\n")
+    out.append("  const char* path;\n")
+    out.append("  const char* contentType;\n")
+    out.append("  const uint8_t* data;         // Gzip compressed\n")
+    out.append("  size_t length;\n")
+    out.append("  const char* etag;\n")
+    out.append("  const char* cacheControl;\n")
+    out.append("};\n\n")
+
+    total_raw = total_gz = 0
+    for path, content_type, ident, raw, cache in assets:
+        gz = compress(raw)
+        total_raw += len(raw)
+        total_gz += len(gz)
+        out.append("// %s: %d bytes, %d gzipped\n" % (path, len(raw), len(gz)))
+        out.append(c_array(ident + "_GZ", gz))
+        out.append("\n")
+
+    for path, ident, raw in templates:
+        out.append("// %s template: %d bytes, {{FIELD}} placeholders filled in when served\n" % (path, len(raw)))
+        out.append(c_array(ident + "_TEMPLATE", raw))
+        out.append("static const size_t %s_TEMPLATE_LENGTH = sizeof(%s_TEMPLATE);\n\n" % (ident, ident))
+
+    out.append("static const WebAsset WEB_ASSETS[] = {\n")
+    for path, content_type, ident, raw, cache in assets:
+        etag = '\\"%s\\"' % content_hash(raw)
+        out.append('  {"%s", "%s", %s_GZ, sizeof(%s_GZ), "%s", "%s"},\n'
+                   % (path, content_type, ident, ident, etag, cache))
+    out.append("};\n")
+    out.append("static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);\n\n")
+    out.append("#endif // WEB_ASSETS_H\n")
+
+    with open(OUTPUT, "w", newline="\r\n") as f:
+        f.write("".join(out))
+
+    print("%d assets, %d bytes minified, %d bytes gzipped -> %s"
+          % (len(assets), total_raw, total_gz, os.path.relpath(OUTPUT, ROOT)))
+
+
+if __name__ == "__main__":
+    build()
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""
+Measure HTTP latency of a running AquaLevel device under concurrent load
+
+Each client keeps one keep-alive connection open and requests the same path
+back to back; latencies of all requests are pooled and reported as
+p50/p99/max together with errors and overall throughput. Run once with
+-c 1 and once with more clients to see how much they slow each other down.
+
+--slow adds clients that send their request one byte at a time, like a phone
+on bad WiFi; with the async server the other clients should not notice them.
+
+Needs only the Python standard library:
+    python3 tools/latency_probe.py 192.168.1.50 -c 8 -n 200
+    python3 tools/latency_probe.py aqualevel.local -c 4 --slow 2 --path /settings
+"""
+
+import argparse
+import http.client
+import math
+import socket
+import threading
+import time
+
+
+def percentile(sorted_values, p):
+    # Nearest rank, so p99 of 100 samples is the 99th value
+    if not sorted_values:
+        return float("nan")
+    rank = max(1, math.ceil(p / 100.0 * len(sorted_values)))
+    return sorted_values[rank - 1]
+
+
+class ClientStats:
+    def __init__(self):
+        self.latencies = []
+        self.errors = 0
+        self.not_modified = 0
+
+
+def run_client(args, stats, start):
+    conn = None
+    etag = None
+    start.wait()
+
+    for _ in range(args.requests):
+        headers = {}
+        if args.revalidate and etag:
+            headers["If-None-Match"] = etag
+
+        try:
+            if conn is None:
+                conn = http.client.HTTPConnection(args.host, args.port, timeout=args.timeout)
+            began = time.perf_counter()
+            conn.request("GET", args.path, headers=headers)
+            response = conn.getresponse()
+            response.read()
+            elapsed = time.perf_counter() - began
+        except (OSError, http.client.HTTPException):
+            stats.errors += 1
+            if conn is not None:
+                conn.close()
+            conn = None
+            continue
+
+        if response.status == 304:
+            stats.not_modified += 1
+        elif response.status != 200:
+            stats.errors += 1
+            continue
+        etag = response.getheader("ETag") or etag
+        stats.latencies.append(elapsed)
+
+        if response.getheader("Connection", "").lower() == "close":
+            conn.close()
+            conn = None
+
+    if conn is not None:
+        conn.close()
+
+
+def run_slow_client(args, stop, start):
+    # Trickle one request at a time until the measured clients are done
+    request = ("GET %s HTTP/1.1\r\nHost: %s\r\n\r\n" % (args.path, args.host)).encode("ascii")
+    start.wait()
+
+    while not stop.is_set():
+        try:
+            with socket.create_connection((args.host, args.port), timeout=args.timeout) as sock:
+                for i in range(len(request)):
+                    if stop.is_set():
+                        return
+                    sock.sendall(request[i:i + 1])
+                    time.sleep(args.slow_delay)
+                sock.recv(4096)
+        except OSError:
+            time.sleep(args.slow_delay)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="HTTP latency probe for an AquaLevel device")
+    parser.add_argument("host", help="device IP address or hostname")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("-c", "--clients", type=int, default=4, help="concurrent clients (default 4)")
+    parser.add_argument("-n", "--requests", type=int, default=100, help="requests per client (default 100)")
+    parser.add_argument("--path", default="/tank-data", help="path to request (default /tank-data)")
+    parser.add_argument("--revalidate", action="store_true",
+                        help="send If-None-Match with the last ETag, like the dashboard does")
+    parser.add_argument("--slow", type=int, default=0, help="extra clients that send their request slowly")
+    parser.add_argument("--slow-delay", type=float, default=0.2, help="seconds between bytes of a slow client")
+    parser.add_argument("--timeout", type=float, default=5.0, help="socket timeout in seconds")
+    args = parser.parse_args()
+
+    start = threading.Event()
+    stop = threading.Event()
+    stats = [ClientStats() for _ in range(args.clients)]
+    threads = [threading.Thread(target=run_client, args=(args, s, start)) for s in stats]
+    slow_threads = [threading.Thread(target=run_slow_client, args=(args, stop, start), daemon=True)
+                    for _ in range(args.slow)]
+
+    for thread in slow_threads + threads:
+        thread.start()
+    began = time.perf_counter()
+    start.set()
+    for thread in threads:
+        thread.join()
+    elapsed = time.perf_counter() - began
+    stop.set()
+
+    latencies = sorted(l for s in stats for l in s.latencies)
+    errors = sum(s.errors for s in stats)
+    not_modified = sum(s.not_modified for s in stats)
+    total = args.clients * args.requests
+
+    print("%s:%d%s  %d clients x %d requests, %d slow clients"
+          % (args.host, args.port, args.path, args.clients, args.requests, args.slow))
+    print("  ok %d (304: %d), errors %d of %d" % (len(latencies), not_modified, errors, total))
+    if latencies:
+        print("  p50 %.1f ms  p99 %.1f ms  max %.1f ms"
+              % (percentile(latencies, 50) * 1000, percentile(latencies, 99) * 1000, latencies[-1] * 1000))
+    print("  %.1f requests/s over %.1f s" % (len(latencies) / elapsed if elapsed > 0 else 0, elapsed))
+
+
+if __name__ == "__main__":
+    main()